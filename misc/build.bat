@@ -48,7 +48,7 @@ pushd W:\build\
 	echo :: HandmadeRalph.cpp
 	del HandmadeRalph_*.pdb > nul 2>&1
 	echo > LOCK.temp
-	clang -o HandmadeRalph.dll %DEBUG_COMPILER_FLAGS% W:\src\HandmadeRalph.cpp -shared -Xlinker /PDB:HandmadeRalph_%RANDOM%.pdb -Xlinker /export:PlatformUpdate -Xlinker /export:PlatformSound
+	clang -o HandmadeRalph.dll %DEBUG_COMPILER_FLAGS% W:\src\HandmadeRalph.cpp -shared -Xlinker /PDB:HandmadeRalph_%RANDOM%.pdb -Xlinker /export:PlatformSimulate -Xlinker /export:PlatformRender -Xlinker /export:PlatformSettle -Xlinker /export:PlatformSound
 	if !ERRORLEVEL! neq 0 (
 		echo :: HandmadeRalph compilation failed
 		del LOCK.temp
@@ -0,0 +1,28 @@
+#!/bin/sh
+# POSIX build of the headless host. The metaprogram is Win32-only, so `src/META/` must already have been generated by `build.bat`.
+
+ROOT="$(cd "$(dirname "$0")/.." && pwd)"
+
+COMMON_COMPILER_FLAGS="\
+	-std=c++20 -pedantic -Weverything -ferror-limit=1\
+	-DDATA_DIR=\"$ROOT/data/\"\
+	-DEXE_DIR=\"$ROOT/build/\"\
+	-DSRC_DIR=\"$ROOT/src/\"\
+	-Wno-c++17-extensions                        -Wno-c++20-designator -Wno-c++98-compat         -Wno-c++98-compat-pedantic -Wno-gnu-zero-variadic-macro-arguments -Wno-duplicate-enum\
+	-Wno-deprecated-copy-with-user-provided-dtor -Wno-missing-braces   -Wno-gnu-anonymous-struct -Wno-nested-anon-types     -Wno-cast-function-type                -Wno-disabled-macro-expansion\
+	-Wno-zero-as-null-pointer-constant           -Wno-double-promotion -Wno-unreachable-code-break"
+
+RELEASE_COMPILER_FLAGS="$COMMON_COMPILER_FLAGS -O2 -g -DDEBUG=0 -Wno-unused-parameter -Wno-unused-function -Wno-unused-variable -Wno-unused-macros -Wno-unused-template"
+
+if [ ! -d "$ROOT/src/META" ]; then
+	echo ":: Missing \`src/META/\`; run the metaprogram first"
+	exit 1
+fi
+
+mkdir -p "$ROOT/build"
+
+echo ":: HandmadeRalph_headless.cpp"
+clang++ -o "$ROOT/build/HandmadeRalph_headless" $RELEASE_COMPILER_FLAGS "$ROOT/src/HandmadeRalph_headless.cpp" -lm -lpthread || {
+	echo ":: HandmadeRalph_headless compilation failed"
+	exit 1
+}
@@ -3,13 +3,15 @@
 #include "rng.cpp"
 
 constexpr i32 CHUNK_DIM        = 16;
+constexpr i32 CHUNK_MASK       = CHUNK_DIM - 1;
+static_assert((CHUNK_DIM & CHUNK_MASK) == 0, "Chunk coordinates are decomposed with shifts and masks.");
 constexpr f32 PIXELS_PER_METER = 80.0f;
 constexpr f32 PIXELS_PER_Z     = 32.0f;
 
 struct BMP
 {
-	vi2  dims;
-	u32* rgba;
+	vi2            dims;
+	OffsetPtr<u32> rgba;
 };
 
 enum Cardinal : u8 // @META@ vf2 vf; vi2 vi;
@@ -25,6 +27,7 @@ struct Hero
 {
 	vi2      coords;
 	vf3      rel_pos;
+	vf3      prev_rel_pos; // @NOTE@ Its `rel_pos` as of the start of the last update, but relative to its tile now, so moves are drawn sliding from the old tile.
 	Cardinal cardinal;
 	i32      hp;
 };
@@ -39,9 +42,11 @@ struct Pet
 {
 	vi2      coords;
 	vf3      rel_pos;
+	vf3      prev_rel_pos; // @NOTE@ Like `Hero::prev_rel_pos`.
 	Cardinal cardinal;
 	f32      hover_t;
 	f32      move_t;
+	f64      simulated_time; // @NOTE@ The `State::sim_time` of the last update it was in the sim region for.
 };
 
 enum struct MonstarFlag : u8
@@ -53,16 +58,14 @@ enum struct MonstarFlag : u8
 };
 #include "META/flag/MonstarFlag.h"
 
+// @NOTE@ Its position within its tile, its timers, and how long it has left once it's dead live in `MonstarPool::hot` instead.
 struct Monstar
 {
 	vi2         coords;
-	vf3         rel_pos;
 	Cardinal    cardinal;
-	f32         hover_t;
-	f32         move_t;
 	i32         hp;
-	f32         existence_t;
 	MonstarFlag flag;
+	f64         simulated_time; // @NOTE@ The `State::sim_time` of the last update it was in the sim region for.
 };
 
 struct PressurePlate
@@ -73,26 +76,320 @@ struct PressurePlate
 
 #include "META/kind/Entity.h" // @META@ Hero, Tree, Pet, Monstar, PressurePlate
 
+// @NOTE@ One bit per tile, row after row, so a row is `CHUNK_DIM` contiguous bits and never straddles two words.
+struct TileBitmap
+{
+	u64 words[CHUNK_DIM * CHUNK_DIM / 64];
+};
+static_assert(64 % CHUNK_DIM == 0, "Rows of a `TileBitmap` are masked out of a single word.");
+
+// @NOTE@ One texel per tile, kept up to date as tiles change so the world map never has to look at the tiles or ground themselves.
+struct ChunkSummary
+{
+	u32 thumbnail[CHUNK_DIM][CHUNK_DIM];
+	u16 tree_count;
+	u16 creature_count;
+	u16 pressure_plate_count;
+};
+
+// @NOTE@ The entity's type in the top bits and an index in the rest. Trees index into their chunk's tree list and monstars into `State::monstars`;
+// the hero and the pet, of which there's only ever the one, are index zero.
+struct EntityHandle
+{
+	u32 bits;
+};
+
+constexpr i32 ENTITY_HANDLE_INDEX_BITS = 29;
+constexpr u32 ENTITY_HANDLE_INDEX_MASK = (1U << ENTITY_HANDLE_INDEX_BITS) - 1;
+
+procedure constexpr EntityHandle handle_of(EntityType type, u32 index = 0) { return { (static_cast<u32>(type) << ENTITY_HANDLE_INDEX_BITS) | index }; }
+procedure constexpr EntityType   type_of  (EntityHandle handle           ) { return static_cast<EntityType>(handle.bits >> ENTITY_HANDLE_INDEX_BITS);  }
+procedure constexpr u32          index_of (EntityHandle handle           ) { return handle.bits & ENTITY_HANDLE_INDEX_MASK;                         }
+
+// @NOTE@ Extras that only a handful of tiles have, kept out of the tiles themselves.
+struct TileFeature
+{
+	OffsetPtr<TileFeature>   next;
+	vi2                      coords;
+	OffsetPtr<PressurePlate> pressure_plate;
+};
+
+constexpr i32 TREE_LIST_MIN_CAPACITY   = 4;
+constexpr i32 TREE_LIST_CLASS_COUNT    = 16; // @NOTE@ Capacities go from `TREE_LIST_MIN_CAPACITY` up by powers of two.
+constexpr i32 CHUNK_GENERATED_TREE_MAX = 32;
+
 struct Chunk
 {
-	bool32    exists;
-	vi2       coords;
-	Tree      tree_buffer[32];
-	i32       tree_count;
-	struct
+	vi2                    coords;
+	OffsetPtr<Chunk>       next_free_chunk;
+	OffsetPtr<Tree>        trees;              // @NOTE@ From the arena, and moved when it grows; tiles refer to trees by index.
+	i32                    tree_count;
+	i32                    tree_capacity;
+	OffsetPtr<TileFeature> features;
+	u64                    change_generation;  // @NOTE@ `State::change_generation` as of the chunk's last change.
+	u64                    listed_generation;  // @NOTE@ `State::change_generation` as of when the chunk last went to the front of the changed chunks.
+	u64                    touched_tick;       // @NOTE@ `ColdChunks::tick` as of the last time the chunk was changed or near the hero or the camera.
+	OffsetPtr<Chunk>       prev_changed_chunk;
+	OffsetPtr<Chunk>       next_changed_chunk;
+	ChunkSummary           summary;
+	TileBitmap             occupied_bitmap;    // @NOTE@ Tiles with any entity at all; kept in step with `tiles` by `set_tile_entity`.
+	TileBitmap             tree_bitmap;
+	TileBitmap             creature_bitmap;
+	EntityHandle           tiles[CHUNK_DIM][CHUNK_DIM];
+};
+
+#include "coords_map.cpp"
+#include "entity_pool.cpp"
+
+#include "monstar_hot.cpp"
+
+constexpr i32 MONSTAR_SLOT_BITS   = 12;
+constexpr i32 MONSTAR_HORDE_COUNT = 1024; // @NOTE@ Spawned all at once around the hero by the debug key.
+
+typedef EntityPool<Monstar, MonstarHot<1 << MONSTAR_SLOT_BITS>, MONSTAR_SLOT_BITS> MonstarPool;
+
+constexpr i32 REGION_DIM_IN_CHUNKS           = 4;
+constexpr i32 REGION_DIM                     = REGION_DIM_IN_CHUNKS * CHUNK_DIM;
+constexpr i32 REGION_MASK                    = REGION_DIM - 1;
+constexpr i32 STREAMING_JOB_CAPACITY         = 8;
+constexpr i32 STREAMING_DEFAULT_RADIUS       = 2 * REGION_DIM;
+constexpr i32 REGION_STORED_TREE_MAX         = REGION_DIM_IN_CHUNKS * REGION_DIM_IN_CHUNKS * CHUNK_GENERATED_TREE_MAX * 2; // @NOTE@ Regions with more trees than this stay resident.
+constexpr i32 STREAMING_RESIDENT_SPAN        = 2 * (STREAMING_DEFAULT_RADIUS + REGION_DIM) / REGION_DIM + 1;               // @NOTE@ Regions across that a single focus keeps resident at the default radius.
+constexpr i32 STREAMING_RESIDENT_CHUNK_COUNT = STREAMING_RESIDENT_SPAN * STREAMING_RESIDENT_SPAN * REGION_DIM_IN_CHUNKS * REGION_DIM_IN_CHUNKS;
+
+enum struct RegionStatus : u8
+{
+	resident, // @NOTE@ Every chunk of the region is in the chunk map.
+	storing,  // @NOTE@ The region's chunks are evicted and being written out.
+	stored,
+	loading   // @NOTE@ No chunks can be created in the region until it's resident again.
+};
+
+struct Region
+{
+	vi2          coords;
+	RegionStatus status;
+};
+
+struct RegionFileHeader
+{
+	u32 magic;
+	u32 version;
+	vi2 coords;
+	i32 chunk_count;
+};
+
+// @NOTE@ Just enough to rebuild a chunk's tiles and summary; whatever's owned by `State` (creatures, pressure plates) keeps its region resident.
+// Each is followed by its `tree_count` trees.
+struct StoredChunk
+{
+	vi2 coords;
+	i32 tree_count;
+};
+
+// @NOTE@ Handed over to a worker thread between being pushed and `done` being set; the main thread leaves it alone in the meantime.
+// The platform procedures and `file_data` are the host's rather than the game's, so they only mean anything while the job's in flight.
+struct StreamingJob
+{
+	bool32                  in_use;
+	bool32                  done;
+	bool32                  succeeded;
+	OffsetPtr<Region>       region;
+	char                    file_path_buffer[256];
+	i64                     file_path_size;
+	PlatformReadFileData_t* PlatformReadFileData;
+	PlatformWriteFile_t*    PlatformWriteFile;
+	PlatformFileData        file_data;
+	u64                     write_size;
+	byte                    write_data[sizeof(RegionFileHeader) + REGION_DIM_IN_CHUNKS * REGION_DIM_IN_CHUNKS * sizeof(StoredChunk) + REGION_STORED_TREE_MAX * sizeof(Tree)];
+};
+
+struct StreamingStats
+{
+	i32 resident_chunk_count;
+	i64 resident_chunk_bytes; // @NOTE@ Chunks, their tree lists, and the chunk map's slots.
+	i32 resident_region_count;
+	i32 stored_region_count;
+	i32 store_count;
+	i32 load_count;
+	i64 bytes_written;
+	i64 bytes_read;
+	i32 failure_count;
+	i64 arena_used;           // @NOTE@ Never shrinks; evicted chunks go onto the free list.
+};
+
+struct Streaming
+{
+	i32               radius; // @NOTE@ In tiles; regions further than this (plus a region of slack) from both the hero and the camera get evicted.
+	CoordsMap<Region> regions;
+	StreamingJob      jobs[STREAMING_JOB_CAPACITY];
+	StreamingStats    stats;
+};
+
+constexpr i32 GENERATION_JOB_CAPACITY = 32;
+constexpr i32 GENERATION_RADIUS       = 3 * CHUNK_DIM; // @NOTE@ In tiles; chunks this close to the hero or the camera get generated ahead of time.
+constexpr vi2 SPAWN_CLEARING_DIMS      = vx2(6);        // @NOTE@ No trees in this corner at the origin, where the hero, pet, pressure plate, and monstar start.
+
+// @NOTE@ Pushed in one update and resolved at the start of the generation step of the next, so which chunks exist never depends on thread timing.
+struct GenerationJob
+{
+	bool32 in_use;
+	bool32 claimed;  // @NOTE@ Whichever of a worker and the main thread sets this first generates the chunk.
+	bool32 done;
+	vi2    chunk_coords;
+	i32    tree_count;
+	Tree   trees[CHUNK_GENERATED_TREE_MAX];
+};
+
+struct GenerationStats
+{
+	i32 worker_count;       // @NOTE@ Generated by a worker thread.
+	i32 main_thread_count;  // @NOTE@ Queued, but the main thread got to it before any worker did.
+	i32 first_access_count; // @NOTE@ Needed before it was ever queued, so generated on the spot.
+	i32 discarded_count;    // @NOTE@ Generated, but the chunk was created some other way (or its region evicted) in the meantime.
+};
+
+struct Generation
+{
+	GenerationJob   jobs[GENERATION_JOB_CAPACITY];
+	GenerationStats stats;
+};
+
+constexpr i32 SIM_REGION_RADIUS          = 2 * CHUNK_DIM;
+constexpr i32 SIM_REGION_ENTITY_CAPACITY = (1 << MONSTAR_SLOT_BITS) + 1; // @NOTE@ Every monstar and the pet.
+
+// @NOTE@ One square of chunks around each of the hero and the camera; rebuilt every update.
+struct SimRegion
+{
+	vi2                                                   min_chunk_coords[2];
+	vi2                                                   max_chunk_coords[2]; // @NOTE@ Inclusive.
+	i32                                                   entity_count;        // @NOTE@ Of every kind.
+	EntityKinds<EntityHandle, SIM_REGION_ENTITY_CAPACITY> entities;            // @NOTE@ Only ever creatures, which don't need their chunk to be resolved; each kind in the order it was gathered.
+	i32                                                   caught_up_count;
+	i32                                                   overflow_count;      // @NOTE@ Creatures that were in range but stayed dormant because the sim region was full.
+};
+
+constexpr i32 SIM_REGION_CHUNK_CAPACITY = 2 * (2 * SIM_REGION_RADIUS / CHUNK_DIM + 1) * (2 * SIM_REGION_RADIUS / CHUNK_DIM + 1); // @NOTE@ Both squares, as if they didn't overlap.
+constexpr i32 MONSTAR_STEP_PARALLEL_MIN = 256;                                                                                     // @NOTE@ Fewer creatures in the sim region than this are stepped on the main thread alone.
+static_assert(SIM_REGION_CHUNK_CAPACITY < 0xFF && SIM_REGION_ENTITY_CAPACITY <= 0x10000, "Jobs and entities are indexed by `u8`s and `u16`s, with 0xFF for no job.");
+
+// @NOTE@ What's left of a monstar's step once its chunk's job is done.
+enum struct MonstarStep : u8
+{
+	none,
+	moved,     // @NOTE@ Within its chunk; the chunk still has to be marked changed, twice, like `move` would have.
+	despawned, // @NOTE@ Off its tile; the chunk still has to be marked changed, and the monstar despawned from the pool.
+	deferred   // @NOTE@ The move or the despawn touches a tile on the edge of a chunk, or the hero, or a pressure plate, or a tile an earlier deferred step did, so the whole of it's left for later.
+};
+
+struct State;
+
+// @NOTE@ The monstars of one chunk of the sim region, stepped by whichever of a worker and the main thread claims the job first.
+struct MonstarStepJob
+{
+	bool32           claimed;
+	bool32           done;
+	OffsetPtr<State> state;
+	OffsetPtr<Chunk> chunk;
+	i32              first_entity; // @NOTE@ Into `MonstarSteps::entities`.
+	i32              entity_count;
+};
+
+struct MonstarSteps
+{
+	i32            job_count;
+	MonstarStepJob jobs       [SIM_REGION_CHUNK_CAPACITY];
+	u16            entities   [SIM_REGION_ENTITY_CAPACITY]; // @NOTE@ Into the sim region's monstars, grouped by chunk but otherwise in order.
+	u8             entity_jobs[SIM_REGION_ENTITY_CAPACITY]; // @NOTE@ Indexed like the sim region's monstars.
+	MonstarStep    steps      [SIM_REGION_ENTITY_CAPACITY]; // @NOTE@ Indexed like the sim region's monstars.
+};
+
+// @NOTE@ What a creature's movement does to whatever it bumps into or steps on. Moves only queue these up; they're handled a type at a time once
+// a batch of movement is done, so the movement itself touches nothing but the creature and the tiles.
+enum struct InteractionType : u8
+{
+	collision,   // @NOTE@ `entity` walked into `other` heading `cardinal`, and gets knocked back.
+	damage,      // @NOTE@ `entity` loses `amount` hp, down to zero.
+	plate_leave, // @NOTE@ Whatever was on the pressure plate at `coords` stepped off or despawned.
+	plate_enter  // @NOTE@ Handled after every `plate_leave`, since a plate can be left and stepped onto again in one batch but never the other way around.
+};
+
+constexpr i32 INTERACTION_TYPE_COUNT = static_cast<i32>(InteractionType::plate_enter) + 1;
+constexpr i32 INTERACTION_CAPACITY   = 1024; // @NOTE@ A full queue is handled early, which comes out the same as handling it after the batch.
+
+struct Interaction
+{
+	InteractionType type;
+	Cardinal        cardinal;
+	u8              amount;
+	EntityHandle    entity;
+	union
 	{
-		EntityRef      entity;
-		PressurePlate* pressure_plate;
-	} tiles[CHUNK_DIM][CHUNK_DIM];
+		EntityHandle other;
+		vi2          coords;
+	};
+};
+static_assert(sizeof(Interaction) == 16);
+
+struct Interactions
+{
+	i32         count;
+	Interaction queue [INTERACTION_CAPACITY];
+	i32         counts[INTERACTION_TYPE_COUNT]; // @NOTE@ How many of each type have been handled this update.
+};
+
+constexpr i32 COLD_CHUNK_TICKS       = 240;                          // @NOTE@ Updates a chunk has to go untouched for before it's compressed.
+constexpr i32 COLD_CHUNK_RADIUS      = 4 * CHUNK_DIM;                // @NOTE@ In tiles; chunks this close to the hero or the camera are touched every update.
+constexpr i32 COLD_CHUNK_SWEEP_SLOTS = 256;                          // @NOTE@ Chunk map slots looked over for chunks to compress each update.
+constexpr i32 COLD_CHUNK_TREE_MAX    = 2 * CHUNK_GENERATED_TREE_MAX; // @NOTE@ Chunks with more trees than this stay warm.
+constexpr i32 PACKED_TREE_BITS       = 8 + 2;                        // @NOTE@ A tile index within the chunk and a BMP index.
+
+// @NOTE@ All there is to a chunk without creatures or tile features is its trees, in tree list order so the tiles' handles line up again once it's unpacked.
+struct PackedChunk
+{
+	vi2 coords;
+	i32 tree_count;
+	u8  bits[(COLD_CHUNK_TREE_MAX * PACKED_TREE_BITS + 7) / 8];
+};
+
+struct ColdChunk
+{
+	OffsetPtr<ColdChunk> next_free_cold_chunk;
+	u64                  change_generation;  // @NOTE@ The chunk's, which it gets back once it's thawed.
+	u64                  listed_generation;  // @NOTE@ Like `Chunk::listed_generation`, but among the cold chunks.
+	OffsetPtr<ColdChunk> prev_changed_chunk;
+	OffsetPtr<ColdChunk> next_changed_chunk;
+	PackedChunk          packed;
+};
+
+struct ColdChunkStats
+{
+	i32 cold_chunk_count;
+	i64 cold_chunk_bytes; // @NOTE@ Cold chunks and the cold chunk map's slots.
+	i64 saved_bytes;      // @NOTE@ What the cold chunks would take up warm (chunk, tree list, and chunk map slot), less what they take up cold.
+	i32 compress_count;
+	i32 decompress_count;
+};
+
+// @NOTE@ Chunks that have gone untouched for a while are packed down and taken out of the chunk map, then unpacked by `find_or_thaw_chunk` the next time they're needed.
+struct ColdChunks
+{
+	u64                  tick;
+	i64                  sweep_index; // @NOTE@ Where in the chunk map's slots the next update picks up looking for chunks to compress.
+	CoordsMap<ColdChunk> chunks;
+	OffsetPtr<ColdChunk> free_cold_chunks;
+	OffsetPtr<ColdChunk> changed_chunks; // @NOTE@ Every cold chunk, most recently frozen first.
+	i64                  warm_bytes;  // @NOTE@ What the cold chunks would take up warm.
+	ColdChunkStats       stats;
 };
 
 constexpr vi2 CACHED_GROUND_BMP_DIMS     = vx2(256);
 constexpr i32 CACHED_GROUND_BMP_CAPACITY = 64;
 struct CachedGroundBMP
 {
-	bool32 exists;
-	vi2    coords;
-	u32*   rgba;
+	bool32         exists;
+	vi2            coords;
+	OffsetPtr<u32> rgba;
 };
 
 struct State
@@ -100,6 +397,7 @@ struct State
 	bool32      inited;
 	u32         seed;
 	MemoryArena arena;
+	i64         world_arena_used; // @NOTE@ What the assets take up; everything allocated past it belongs to the world, and is thrown away when a save is loaded.
 
 	union
 	{
@@ -121,32 +419,79 @@ struct State
 	};
 	#include "META/asset/bmp_file_paths.h"
 
-	Chunk             chunk_hashtable[256];
-	Hero              hero;
-	Pet               pet;
-	Monstar           monstar;
-	PressurePlate     pressure_plate;
-	vi2               camera_coords;
-	vf2               camera_rel_pos;
+	ChunkMap               chunk_map;
+	OffsetPtr<Chunk>       free_chunks;
+	OffsetPtr<Tree>        free_tree_lists[TREE_LIST_CLASS_COUNT]; // @NOTE@ Each freed list's first bytes hold how far away the next is.
+	OffsetPtr<TileFeature> free_tile_features;
+	vi2                    last_found_chunk_coords; // @NOTE@ Kept beside the pointer so a cache hit doesn't touch the chunk.
+	OffsetPtr<Chunk>       last_found_chunk;        // @NOTE@ Reset every frame.
+	u64                    change_generation;       // @NOTE@ Bumped on every change to any chunk; never goes back, even across loads.
+	OffsetPtr<Chunk>       changed_chunks;          // @NOTE@ Every chunk, most recently changed first.
+	Streaming              streaming;
+	Generation             generation;
+	ColdChunks             cold_chunks;
+	f64                    sim_time;
+	SimRegion              sim_region;
+	MonstarSteps           monstar_steps;
+	Interactions           interactions;
+	Hero                   hero;
+	Pet                    pet;
+	MonstarPool            monstars;
+	PressurePlate          pressure_plate;
+	vi2                    camera_coords;
+	vf2                    camera_rel_pos;
+	vf2                    camera_prev_rel_pos; // @NOTE@ Like `Hero::prev_rel_pos`.
+};
+
+struct OverdrawMap
+{
+	u32*           target; // @NOTE@ The host's framebuffer, so it's set again every frame.
+	vi2            dims;
+	OffsetPtr<u16> counts;
 };
 
 struct TransState
 {
-	bool32           inited;
-	MemoryArena      arena;
-	CachedGroundBMP* cached_ground_bmps;
+	bool32                     inited;
+	MemoryArena                arena;
+	OffsetPtr<CachedGroundBMP> cached_ground_bmps;
+	bool32                     world_map_mode;
+	bool32                     overdraw_mode;
+	OverdrawMap                overdraw_map;
+	f32                        overdraw_ratio;
 };
 
+// @NOTE@ Only set while the overdraw visualization is rendering; writes into any other BMP (e.g. the ground cache) are not counted.
+global OverdrawMap* g_overdraw_map = 0;
+
+procedure u16* overdraw_counts_of(BMP dst)
+{
+	if (g_overdraw_map && g_overdraw_map->target == dst.rgba)
+	{
+		ASSERT(g_overdraw_map->dims == dst.dims);
+		return g_overdraw_map->counts;
+	}
+	else
+	{
+		return 0;
+	}
+}
+
 procedure void draw_rect(BMP dst, vi2 center, vi2 dims, u32 rgba)
 {
 	ASSERT(IN_RANGE(dims.x, 0, 2048));
 	ASSERT(IN_RANGE(dims.y, 0, 2048));
-	vi2 start = { center.x - dims.x / 2, dst.dims.y - center.y - dims.y / 2 };
+	vi2  start  = { center.x - dims.x / 2, dst.dims.y - center.y - dims.y / 2 };
+	u16* counts = overdraw_counts_of(dst);
 	FOR_RANGE(y, max(start.y, 0), min(start.y + dims.y, dst.dims.y))
 	{
 		FOR_RANGE(x, max(start.x, 0), min(start.x + dims.x, dst.dims.x))
 		{
 			dst.rgba[y * dst.dims.x + x] = rgba;
+			if (counts)
+			{
+				counts[y * dst.dims.x + x] += 1;
+			}
 		}
 	}
 }
@@ -162,11 +507,17 @@ procedure void draw_rect_outline(BMP dst, vi2 center, vi2 dims, u32 rgba)
 
 procedure void draw_bmp(BMP dst, BMP src, vi2 center, f32 alpha = 1.0f)
 {
-	vi2 start = { center.x - src.dims.x / 2, dst.dims.y - center.y - src.dims.y / 2 };
+	vi2  start  = { center.x - src.dims.x / 2, dst.dims.y - center.y - src.dims.y / 2 };
+	u16* counts = overdraw_counts_of(dst);
 	FOR_RANGE(y, max(start.y, 0), min(start.y + src.dims.y, dst.dims.y))
 	{
 		FOR_RANGE(x, max(start.x, 0), min(start.x + src.dims.x, dst.dims.x))
 		{
+			if (counts)
+			{
+				counts[y * dst.dims.x + x] += 1;
+			}
+
 			aliasing bot = dst.rgba[y * dst.dims.x + x];
 			aliasing top = src.rgba[(y - start.y) * src.dims.x + x - start.x];
 			bot =
@@ -186,6 +537,7 @@ procedure void draw_circle(BMP dst, vi2 pos, i32 radius, u32 rgba)
 	i32 y0 = clamp(dst.dims.y - pos.y - radius, 0, dst.dims.y);
 	i32 y1 = clamp(dst.dims.y - pos.y + radius, 0, dst.dims.y);
 
+	u16* counts = overdraw_counts_of(dst);
 	FOR_RANGE(x, x0, x1)
 	{
 		FOR_RANGE(y, y0, y1)
@@ -193,6 +545,10 @@ procedure void draw_circle(BMP dst, vi2 pos, i32 radius, u32 rgba)
 			if (square(x - pos.x) + square(y - dst.dims.y + pos.y) <= square(radius))
 			{
 				dst.rgba[y * dst.dims.x + x] = rgba;
+				if (counts)
+				{
+					counts[y * dst.dims.x + x] += 1;
+				}
 			}
 		}
 	}
@@ -207,35 +563,1196 @@ procedure u32 rgba_from(vf3 rgb)
 	return rgba_from(rgb.x, rgb.y, rgb.z);
 }
 
-procedure Chunk* get_chunk(State* state, vi2 coords)
-{
-	vi2 chunk_coords =
+procedure u32 summary_rgba_of(EntityType type, PressurePlate* pressure_plate)
+{
+	switch (type)
+	{
+		case EntityType::Hero    : return rgba_from(0.2f, 0.4f, 0.9f);
+		case EntityType::Pet     : return rgba_from(0.2f, 0.8f, 0.8f);
+		case EntityType::Monstar : return rgba_from(0.9f, 0.2f, 0.2f);
+		case EntityType::Tree    : return rgba_from(0.1f, 0.3f, 0.1f);
+
+		case EntityType::null:
+		case EntityType::PressurePlate:
+		{
+			if (pressure_plate)
+			{
+				return pressure_plate->pressed ? rgba_from(0.8f, 0.8f, 0.8f) : rgba_from(0.4f, 0.4f, 0.4f);
+			}
+			else
+			{
+				return rgba_from(0.3f, 0.4f, 0.2f);
+			}
+		} break;
+	}
+}
+
+// @NOTE@ Two's complement masking floors towards negative infinity, so negative coordinates need no special casing.
+procedure constexpr vi2 chunk_coords_of(vi2 coords) { return { coords.x & ~CHUNK_MASK, coords.y & ~CHUNK_MASK }; }
+procedure constexpr vi2 rel_coords_of  (vi2 coords) { return { coords.x &  CHUNK_MASK, coords.y &  CHUNK_MASK }; }
+procedure constexpr vi2 region_coords_of(vi2 coords) { return { coords.x & ~REGION_MASK, coords.y & ~REGION_MASK }; }
+
+//
+// Tile bitmaps.
+//
+
+constexpr i32 TILE_BITMAP_ROWS_PER_WORD = 64 / CHUNK_DIM;
+constexpr u64 TILE_BITMAP_ROW_MASK      = CHUNK_DIM == 64 ? ~0ULL : (1ULL << (CHUNK_DIM % 64)) - 1;
+
+procedure bool32 test(TileBitmap* bitmap, vi2 rel_coords)
+{
+	i32 bit_index = rel_coords.y * CHUNK_DIM + rel_coords.x;
+	return (bitmap->words[bit_index / 64] >> (bit_index % 64)) & 1;
+}
+
+procedure void set(TileBitmap* bitmap, vi2 rel_coords, bool32 value)
+{
+	i32 bit_index = rel_coords.y * CHUNK_DIM + rel_coords.x;
+	if (value)
+	{
+		bitmap->words[bit_index / 64] |=  (1ULL << (bit_index % 64));
+	}
+	else
+	{
+		bitmap->words[bit_index / 64] &= ~(1ULL << (bit_index % 64));
+	}
+}
+
+procedure i32 count_set_tiles(TileBitmap* bitmap)
+{
+	i32 count = 0;
+	FOR_ELEMS(it, bitmap->words)
+	{
+		count += static_cast<i32>(count_set_bits(*it));
+	}
+	return count;
+}
+
+// @NOTE@ `min_rel_coords` is inclusive and `max_rel_coords` exclusive; one popcount per row.
+procedure i32 count_set_tiles(TileBitmap* bitmap, vi2 min_rel_coords, vi2 max_rel_coords)
+{
+	ASSERT(0 <= min_rel_coords.x && min_rel_coords.x <= max_rel_coords.x && max_rel_coords.x <= CHUNK_DIM);
+	ASSERT(0 <= min_rel_coords.y && min_rel_coords.y <= max_rel_coords.y && max_rel_coords.y <= CHUNK_DIM);
+
+	u64 row_mask = (TILE_BITMAP_ROW_MASK >> (CHUNK_DIM - (max_rel_coords.x - min_rel_coords.x))) << min_rel_coords.x;
+	i32 count = 0;
+	FOR_RANGE(y, min_rel_coords.y, max_rel_coords.y)
+	{
+		count += static_cast<i32>(count_set_bits((bitmap->words[y / TILE_BITMAP_ROWS_PER_WORD] >> (y % TILE_BITMAP_ROWS_PER_WORD * CHUNK_DIM)) & row_mask));
+	}
+	return count;
+}
+
+// @NOTE@ The tile of the `n`th clear bit in row-major order; `n` has to be less than the number of clear bits.
+procedure vi2 nth_clear_tile(TileBitmap* bitmap, i32 n)
+{
+	ASSERT(IN_RANGE(n, 0, CHUNK_DIM * CHUNK_DIM - count_set_tiles(bitmap)));
+	FOR_ELEMS(it, bitmap->words)
+	{
+		u64 clear_bits  = ~*it;
+		i32 clear_count = static_cast<i32>(count_set_bits(clear_bits));
+		if (n < clear_count)
+		{
+			FOR_RANGE(n)
+			{
+				clear_bits &= clear_bits - 1;
+			}
+			i32 bit_index = static_cast<i32>(it_index) * 64 + static_cast<i32>(count_trailing_zeros(clear_bits));
+			return { bit_index % CHUNK_DIM, bit_index / CHUNK_DIM };
+		}
+		n -= clear_count;
+	}
+
+	ASSERT(false);
+	return {};
+}
+
+// @NOTE@ Up to `max_count` unoccupied tiles of the chunk in row-major order; returns how many were found.
+procedure i32 find_free_tiles(vi2* coords, i32 max_count, Chunk* chunk)
+{
+	i32 count = 0;
+	FOR_ELEMS(it, chunk->occupied_bitmap.words)
+	{
+		u64 clear_bits = ~*it;
+		while (clear_bits && count < max_count)
+		{
+			i32 bit_index = static_cast<i32>(it_index) * 64 + static_cast<i32>(count_trailing_zeros(clear_bits));
+			coords[count]  = chunk->coords + vi2 { bit_index % CHUNK_DIM, bit_index / CHUNK_DIM };
+			count         += 1;
+			clear_bits    &= clear_bits - 1;
+		}
+	}
+	return count;
+}
+
+//
+// Change tracking.
+//
+
+// @NOTE@ A chunk changes whenever it's created or anything of its tiles, trees, or tile features does. Keeping the chunks ordered by when they last went to the front
+// means asking for the chunks changed since some generation only ever walks those chunks, plus any that were thawed since. Going cold and thawing again isn't a change,
+// so a chunk keeps its change generation through both, and while it's cold it's in the cold chunks' list instead. Evicted chunks drop out, since they're unchanged on disk.
+#define FOR_CHANGED_CHUNKS_(NAME, TYPE, CHANGED_CHUNKS, GENERATION) for (TYPE* NAME = (CHANGED_CHUNKS); NAME && NAME->listed_generation > (GENERATION); NAME = NAME->next_changed_chunk) if (NAME->change_generation <= (GENERATION)) {} else
+#define FOR_CHANGED_CHUNKS(NAME, STATE, GENERATION)                 FOR_CHANGED_CHUNKS_(NAME, Chunk    , (STATE)->changed_chunks            , (GENERATION))
+#define FOR_CHANGED_COLD_CHUNKS(NAME, STATE, GENERATION)            FOR_CHANGED_CHUNKS_(NAME, ColdChunk, (STATE)->cold_chunks.changed_chunks, (GENERATION))
+
+template <typename CHUNK>
+procedure void unlink_changed_chunk(OffsetPtr<CHUNK>* changed_chunks, CHUNK* chunk)
+{
+	if (chunk->prev_changed_chunk)
+	{
+		chunk->prev_changed_chunk->next_changed_chunk = chunk->next_changed_chunk;
+	}
+	else if (*changed_chunks == chunk)
+	{
+		*changed_chunks = chunk->next_changed_chunk;
+	}
+	if (chunk->next_changed_chunk)
+	{
+		chunk->next_changed_chunk->prev_changed_chunk = chunk->prev_changed_chunk;
+	}
+	chunk->prev_changed_chunk = 0;
+	chunk->next_changed_chunk = 0;
+}
+
+// @NOTE@ Always as of the latest generation, which is what keeps the list in order.
+template <typename CHUNK>
+procedure void relink_changed_chunk(State* state, OffsetPtr<CHUNK>* changed_chunks, CHUNK* chunk)
+{
+	chunk->listed_generation = state->change_generation;
+	if (*changed_chunks != chunk)
+	{
+		unlink_changed_chunk(changed_chunks, chunk);
+		chunk->next_changed_chunk = *changed_chunks;
+		if (*changed_chunks)
+		{
+			(*changed_chunks)->prev_changed_chunk = chunk;
+		}
+		*changed_chunks = chunk;
+	}
+}
+
+procedure void mark_chunk_changed(State* state, Chunk* chunk)
+{
+	state->change_generation += 1;
+	chunk->change_generation  = state->change_generation;
+	chunk->touched_tick       = state->cold_chunks.tick;
+	relink_changed_chunk(state, &state->changed_chunks, chunk);
+}
+
+//
+// Chunks.
+//
+
+procedure Chunk* thaw_chunk(State* state, ColdChunk* cold_chunk);
+
+procedure Chunk* find_chunk(State* state, vi2 coords)
+{
+	vi2 chunk_coords = chunk_coords_of(coords);
+	if (state->last_found_chunk && state->last_found_chunk_coords == chunk_coords)
+	{
+		return state->last_found_chunk;
+	}
+
+	Chunk* chunk = find(&state->chunk_map, chunk_coords);
+	if (chunk)
+	{
+		state->last_found_chunk_coords = chunk_coords;
+		state->last_found_chunk        = chunk;
+	}
+	return chunk;
+}
+
+// @NOTE@ An empty chunk in the chunk map, but not yet in the changed chunks; null if there's no room.
+procedure Chunk* create_chunk(State* state, vi2 chunk_coords)
+{
+	ASSERT(chunk_coords_of(chunk_coords) == chunk_coords);
+
+	Chunk* chunk = state->free_chunks;
+	if (chunk)
+	{
+		state->free_chunks = chunk->next_free_chunk;
+	}
+	else
+	{
+		chunk = allocate<Chunk>(&state->arena);
+		if (!chunk)
+		{
+			return 0;
+		}
+	}
+
+	*chunk        = {};
+	chunk->coords = chunk_coords;
+	FOR_ELEMS(it, &chunk->summary.thumbnail[0][0], CHUNK_DIM * CHUNK_DIM)
+	{
+		*it = summary_rgba_of({}, 0);
+	}
+
+	if (!insert(&state->chunk_map, &state->arena, chunk_coords, chunk))
+	{
+		chunk->next_free_chunk = state->free_chunks;
+		state->free_chunks     = chunk;
+		return 0;
+	}
+
+	state->last_found_chunk_coords = chunk_coords;
+	state->last_found_chunk        = chunk;
+	return chunk;
+}
+
+// @NOTE@ Like `find_chunk`, but a cold chunk gets thawed back out; for whoever's about to change the chunk or keep it around, not just look at it.
+procedure Chunk* find_or_thaw_chunk(State* state, vi2 coords)
+{
+	Chunk* chunk = find_chunk(state, coords);
+	if (!chunk && state->cold_chunks.chunks.count)
+	{
+		ColdChunk* cold_chunk = find(&state->cold_chunks.chunks, chunk_coords_of(coords));
+		if (cold_chunk)
+		{
+			chunk = thaw_chunk(state, cold_chunk);
+		}
+	}
+	return chunk;
+}
+
+procedure Chunk* get_or_create_chunk(State* state, vi2 coords)
+{
+	Chunk* chunk = find_or_thaw_chunk(state, coords);
+	if (!chunk)
+	{
+		// @NOTE@ A chunk created in a region that's on disk would be clobbered once the region is loaded back in.
+		Region* region = find(&state->streaming.regions, region_coords_of(coords));
+		if (region)
+		{
+			if (region->status != RegionStatus::resident)
+			{
+				return 0;
+			}
+		}
+		else
+		{
+			region = allocate<Region>(&state->arena);
+			if (!region)
+			{
+				return 0;
+			}
+
+			*region = { .coords = region_coords_of(coords), .status = RegionStatus::resident };
+			if (!insert(&state->streaming.regions, &state->arena, region->coords, region))
+			{
+				return 0;
+			}
+		}
+
+		chunk = create_chunk(state, chunk_coords_of(coords));
+		if (chunk)
+		{
+			mark_chunk_changed(state, chunk);
+		}
+	}
+
+	return chunk;
+}
+
+procedure void release_tree_list(State* state, Chunk* chunk)
+{
+	if (chunk->tree_capacity)
+	{
+		i32 list_class = static_cast<i32>(count_trailing_zeros(static_cast<u32>(chunk->tree_capacity / TREE_LIST_MIN_CAPACITY)));
+		ASSERT(IN_RANGE(list_class, 0, TREE_LIST_CLASS_COUNT));
+		// @NOTE@ Lists are only as aligned as `Tree` is, so the link is copied in bytewise, and it's an offset like an `OffsetPtr` so it holds up wherever the arena ends up.
+		Tree* next_list = state->free_tree_lists[list_class];
+		i64   offset    = next_list ? reinterpret_cast<byte*>(next_list) - reinterpret_cast<byte*>(static_cast<Tree*>(chunk->trees)) : 0;
+		memcpy(chunk->trees, &offset, sizeof(offset));
+		state->free_tree_lists[list_class] = chunk->trees;
+	}
+	chunk->trees         = 0;
+	chunk->tree_count    = 0;
+	chunk->tree_capacity = 0;
+}
+
+procedure void delete_chunk(State* state, Chunk* chunk)
+{
+	Chunk* erased = erase(&state->chunk_map, chunk->coords);
+	ASSERT(erased == chunk);
+	if (state->last_found_chunk == chunk)
+	{
+		state->last_found_chunk = 0;
+	}
+
+	unlink_changed_chunk(&state->changed_chunks, chunk);
+	release_tree_list(state, chunk);
+	while (chunk->features)
+	{
+		TileFeature* feature      = chunk->features;
+		chunk->features           = feature->next;
+		feature->next             = state->free_tile_features;
+		state->free_tile_features = feature;
+	}
+
+	chunk->next_free_chunk = state->free_chunks;
+	state->free_chunks     = chunk;
+}
+
+procedure TileFeature* find_tile_feature(Chunk* chunk, vi2 coords)
+{
+	FOR_NODES(feature, chunk->features)
+	{
+		if (feature->coords == coords)
+		{
+			return feature;
+		}
+	}
+	return 0;
+}
+
+procedure PressurePlate* pressure_plate_of(Chunk* chunk, vi2 coords)
+{
+	TileFeature* feature = find_tile_feature(chunk, coords);
+	return feature ? feature->pressure_plate : 0;
+}
+
+procedure EntityRef entity_of(State* state, Chunk* chunk, EntityHandle handle)
+{
+	switch (type_of(handle))
+	{
+		case EntityType::Hero : return ref(&state->hero);
+		case EntityType::Pet  : return ref(&state->pet );
+		case EntityType::Monstar:
+		{
+			// @NOTE@ A handle left behind by a despawned monstar resolves to nothing.
+			Monstar* monstar = find(&state->monstars, index_of(handle));
+			return monstar ? ref(monstar) : EntityRef {};
+		} break;
+
+		case EntityType::Tree:
+		{
+			ASSERT(index_of(handle) < static_cast<u32>(chunk->tree_count));
+			return ref(&chunk->trees[index_of(handle)]);
+		} break;
+
+		case EntityType::null:
+		case EntityType::PressurePlate:
+		{
+			return {};
+		} break;
+	}
+}
+
+procedure void refresh_summary(Chunk* chunk, vi2 coords)
+{
+	ASSERT(chunk_coords_of(coords) == chunk->coords);
+	vi2 rel_coords = rel_coords_of(coords);
+	chunk->summary.thumbnail[rel_coords.y][rel_coords.x] = summary_rgba_of(type_of(chunk->tiles[rel_coords.y][rel_coords.x]), pressure_plate_of(chunk, coords));
+}
+
+// @NOTE@ Everything `set_tile_entity` does but mark the chunk changed, which touches the list of every changed chunk; for whoever marks it themselves later.
+procedure void put_tile_entity(Chunk* chunk, vi2 coords, EntityHandle handle)
+{
+	lambda tally =
+		[&](EntityHandle x, i32 delta)
+		{
+			switch (type_of(x))
+			{
+				case EntityType::Tree:
+				{
+					chunk->summary.tree_count = static_cast<u16>(chunk->summary.tree_count + delta);
+				} break;
+
+				case EntityType::Hero:
+				case EntityType::Pet:
+				case EntityType::Monstar:
+				{
+					chunk->summary.creature_count = static_cast<u16>(chunk->summary.creature_count + delta);
+				} break;
+
+				case EntityType::null:
+				case EntityType::PressurePlate:
+				{
+				} break;
+			}
+		};
+
+	ASSERT(chunk_coords_of(coords) == chunk->coords);
+	aliasing tile = chunk->tiles[rel_coords_of(coords).y][rel_coords_of(coords).x];
+	tally(tile  , -1);
+	tally(handle, +1);
+	tile = handle;
+
+	EntityType type = type_of(handle);
+	set(&chunk->occupied_bitmap, rel_coords_of(coords), type != EntityType::null);
+	set(&chunk->tree_bitmap    , rel_coords_of(coords), type == EntityType::Tree);
+	set(&chunk->creature_bitmap, rel_coords_of(coords), type == EntityType::Hero || type == EntityType::Pet || type == EntityType::Monstar);
+
+	refresh_summary(chunk, coords);
+}
+
+procedure void set_tile_entity(State* state, Chunk* chunk, vi2 coords, EntityHandle handle)
+{
+	put_tile_entity(chunk, coords, handle);
+	mark_chunk_changed(state, chunk);
+}
+
+procedure bool32 set_tile_pressure_plate(State* state, Chunk* chunk, vi2 coords, PressurePlate* pressure_plate)
+{
+	ASSERT(chunk_coords_of(coords) == chunk->coords);
+
+	OffsetPtr<TileFeature>* feature_slot = &chunk->features;
+	while (*feature_slot && (*feature_slot)->coords != coords)
+	{
+		feature_slot = &(*feature_slot)->next;
+	}
+
+	if (*feature_slot)
+	{
+		chunk->summary.pressure_plate_count = static_cast<u16>(chunk->summary.pressure_plate_count - 1);
+		if (pressure_plate)
+		{
+			(*feature_slot)->pressure_plate = pressure_plate;
+		}
+		else
+		{
+			TileFeature* feature      = *feature_slot;
+			*feature_slot             = feature->next;
+			feature->next             = state->free_tile_features;
+			state->free_tile_features = feature;
+		}
+	}
+	else if (pressure_plate)
+	{
+		TileFeature* feature = state->free_tile_features;
+		if (feature)
+		{
+			state->free_tile_features = feature->next;
+		}
+		else
+		{
+			feature = allocate<TileFeature>(&state->arena);
+			if (!feature)
+			{
+				return false;
+			}
+		}
+
+		*feature        = { .next = chunk->features, .coords = coords, .pressure_plate = pressure_plate };
+		chunk->features = feature;
+	}
+
+	if (pressure_plate)
+	{
+		chunk->summary.pressure_plate_count = static_cast<u16>(chunk->summary.pressure_plate_count + 1);
+	}
+	refresh_summary(chunk, coords);
+	mark_chunk_changed(state, chunk);
+	return true;
+}
+
+// @NOTE@ What a chunk's tree list ends up as once `add_tree` has added this many trees to it.
+procedure i32 tree_list_capacity_of(i32 tree_count)
+{
+	i32 capacity = 0;
+	if (tree_count)
+	{
+		capacity = TREE_LIST_MIN_CAPACITY;
+		while (capacity < tree_count)
+		{
+			capacity *= 2;
+		}
+	}
+	return capacity;
+}
+
+// @NOTE@ Everything `add_tree` does but mark the chunk changed, for putting back trees the chunk already had.
+procedure Tree* place_tree(State* state, Chunk* chunk, vi2 coords, i32 bmp_index)
+{
+	ASSERT(chunk_coords_of(coords) == chunk->coords);
+	ASSERT(!test(&chunk->occupied_bitmap, rel_coords_of(coords)));
+
+	if (chunk->tree_count == chunk->tree_capacity)
+	{
+		i32 capacity   = chunk->tree_capacity ? chunk->tree_capacity * 2 : TREE_LIST_MIN_CAPACITY;
+		i32 list_class = static_cast<i32>(count_trailing_zeros(static_cast<u32>(capacity / TREE_LIST_MIN_CAPACITY)));
+		if (!IN_RANGE(list_class, 0, TREE_LIST_CLASS_COUNT))
+		{
+			return 0;
+		}
+
+		Tree* trees = state->free_tree_lists[list_class];
+		if (trees)
+		{
+			i64 offset;
+			memcpy(&offset, trees, sizeof(offset));
+			state->free_tree_lists[list_class] = offset ? reinterpret_cast<Tree*>(reinterpret_cast<byte*>(trees) + offset) : 0;
+		}
+		else
+		{
+			trees = allocate<Tree>(&state->arena, capacity);
+			if (!trees)
+			{
+				return 0;
+			}
+		}
+
+		if (chunk->tree_count)
+		{
+			memcpy(trees, chunk->trees, static_cast<u64>(chunk->tree_count) * sizeof(Tree));
+		}
+		i32 tree_count = chunk->tree_count;
+		release_tree_list(state, chunk);
+		chunk->trees         = trees;
+		chunk->tree_count    = tree_count;
+		chunk->tree_capacity = capacity;
+	}
+
+	Tree* tree = &chunk->trees[chunk->tree_count];
+	*tree = { .coords = coords, .bmp_index = bmp_index };
+	put_tile_entity(chunk, coords, handle_of(EntityType::Tree, static_cast<u32>(chunk->tree_count)));
+	chunk->tree_count += 1;
+	return tree;
+}
+
+// @NOTE@ Null if the arena's out of room. The returned tree, like any other in the chunk, only stays put until the next tree is added.
+procedure Tree* add_tree(State* state, Chunk* chunk, vi2 coords, i32 bmp_index)
+{
+	Tree* tree = place_tree(state, chunk, coords, bmp_index);
+	if (tree)
+	{
+		mark_chunk_changed(state, chunk);
+	}
+	return tree;
+}
+
+// @NOTE@ A job pushed with `push_job` gets done by whichever of a worker and the main thread claims it first; the other leaves it be.
+// A job's reused from one update to the next, so a push of it from before may still be sitting in the queue when it's pushed again.
+// That's fine: the stale push is just one more claimant, and it does the job as it's been set up now.
+template <typename JOB>
+procedure bool32 push_job(PlatformPushWork_t* PlatformPushWork, PlatformWork_t* platform_work, JOB* job)
+{
+	job->done = false;
+	__atomic_store_n(&job->claimed, false, __ATOMIC_RELEASE);
+	return PlatformPushWork(platform_work, job);
+}
+
+template <typename JOB>
+procedure bool32 claim_job(JOB* job)
+{
+	return !__atomic_exchange_n(&job->claimed, true, __ATOMIC_ACQUIRE);
+}
+
+// @NOTE@ True if the main thread claimed the job and has to do it itself; otherwise waits out the worker that has, since a job doesn't take long.
+template <typename JOB>
+procedure bool32 claim_job_or_wait(JOB* job)
+{
+	if (claim_job(job))
+	{
+		return true;
+	}
+	while (!__atomic_load_n(&job->done, __ATOMIC_ACQUIRE))
+	{
+		__builtin_ia32_pause();
+	}
+	return false;
+}
+
+#include "spatial_query.cpp"
+#include "spatial_hash.cpp"
+#include "cold_chunks.cpp"
+#include "streaming.cpp"
+#include "generation.cpp"
+#include "sim_region.cpp"
+#include "save.cpp"
+
+//
+// Creatures.
+//
+
+// @NOTE@ A pass over the queue for each type, in the order the types are declared.
+procedure void handle_interactions(State* state)
+{
+	aliasing interactions = state->interactions;
+	FOR_RANGE(type_index, INTERACTION_TYPE_COUNT)
+	{
+		FOR_ELEMS(it, interactions.queue, interactions.count)
+		{
+			if (it->type != static_cast<InteractionType>(type_index))
+			{
+				continue;
+			}
+			interactions.counts[type_index] += 1;
+
+			switch (it->type)
+			{
+				case InteractionType::collision:
+				{
+					vi2       delta_coords = META_Cardinal[it->cardinal].vi;
+					EntityRef entity       = entity_of(state, 0, it->entity);
+					Hero*     hero;
+					Monstar*  monstar;
+					if (deref(&hero, entity))
+					{
+						hero->rel_pos.xy += delta_coords / 2.0f;
+					}
+					else if (deref(&monstar, entity))
+					{
+						i64 index = monstar - state->monstars.elems;
+						state->monstars.hot.rel_pos_x[index] += delta_coords.x / 2.0f;
+						state->monstars.hot.rel_pos_y[index] += delta_coords.y / 2.0f;
+					}
+				} break;
+
+				case InteractionType::damage:
+				{
+					EntityRef entity = entity_of(state, 0, it->entity);
+					Hero*     hero;
+					Monstar*  monstar;
+					if (deref(&hero, entity))
+					{
+						hero->hp = max(hero->hp - it->amount, 0);
+					}
+					else if (deref(&monstar, entity))
+					{
+						monstar->hp = max(monstar->hp - it->amount, 0);
+					}
+				} break;
+
+				case InteractionType::plate_leave:
+				{
+					PressurePlate* pressure_plate = pressure_plate_of(find_chunk(state, it->coords), it->coords);
+					ASSERT(pressure_plate && pressure_plate->pressed);
+					pressure_plate->pressed = false;
+				} break;
+
+				case InteractionType::plate_enter:
+				{
+					PressurePlate* pressure_plate = pressure_plate_of(find_chunk(state, it->coords), it->coords);
+					ASSERT(pressure_plate && !pressure_plate->pressed);
+					pressure_plate->pressed = true;
+				} break;
+			}
+		}
+	}
+
+	interactions.count = 0;
+}
+
+procedure void push_interaction(State* state, Interaction interaction)
+{
+	aliasing interactions = state->interactions;
+	if (interactions.count == capacityof(interactions.queue))
+	{
+		handle_interactions(state);
+	}
+	interactions.queue[interactions.count] = interaction;
+	interactions.count += 1;
+}
+
+// @NOTE@ Keeps where it's drawn from relative to the tile it's on after it moves by `delta_coords`.
+procedure void shift_prev_rel_pos(State* state, EntityRef entity, vi2 delta_coords)
+{
+	Hero*    hero;
+	Pet*     pet;
+	Monstar* monstar;
+	if (deref(&hero, entity))
+	{
+		hero->prev_rel_pos.xy -= delta_coords;
+	}
+	else if (deref(&pet, entity))
+	{
+		pet->prev_rel_pos.xy -= delta_coords;
+	}
+	else if (deref(&monstar, entity))
+	{
+		i64 index = monstar - state->monstars.elems;
+		state->monstars.hot.prev_rel_pos_x[index] -= static_cast<f32>(delta_coords.x);
+		state->monstars.hot.prev_rel_pos_y[index] -= static_cast<f32>(delta_coords.y);
+	}
+}
+
+procedure void move(State* state, EntityRef entity, Cardinal movement)
+{
+	vi2* coords;
+	//vf3* rel_pos;
+	switch (entity.ref_type)
+	{
+		case EntityType::Hero:
+		{
+			coords  = &entity.Hero_->coords;
+			//rel_pos = &entity.Hero_->rel_pos;
+		} break;
+
+		case EntityType::Pet:
+		{
+			coords  = &entity.Pet_->coords;
+			//rel_pos = &entity.Pet_->rel_pos;
+		} break;
+
+		case EntityType::Monstar:
+		{
+			coords  = &entity.Monstar_->coords;
+			//rel_pos = &entity.Monstar_->rel_pos;
+		} break;
+
+		case EntityType::null:
+		case EntityType::Tree:
+		case EntityType::PressurePlate:
+		{
+			ASSERT(false);
+			return;
+		} break;
+	}
+
+	vi2 delta_coords = META_Cardinal[movement].vi;
+
+	Chunk* old_chunk = find_chunk           (state, *coords               );
+	Chunk* new_chunk = get_or_generate_chunk(state, *coords + delta_coords);
+	ASSERT(old_chunk);
+	if (!new_chunk)
+	{
+		return;
+	}
+
+	vi2      old_rel_coords = rel_coords_of(*coords               );
+	vi2      new_rel_coords = rel_coords_of(*coords + delta_coords);
+	aliasing old_tile       = old_chunk->tiles[old_rel_coords.y][old_rel_coords.x];
+	aliasing new_tile       = new_chunk->tiles[new_rel_coords.y][new_rel_coords.x];
+
+	ASSERT(test(&old_chunk->occupied_bitmap, old_rel_coords));
+	if (!test(&new_chunk->occupied_bitmap, new_rel_coords))
+	{
+		if (pressure_plate_of(old_chunk, *coords))
+		{
+			push_interaction(state, { .type = InteractionType::plate_leave, .coords = *coords });
+		}
+		if (pressure_plate_of(new_chunk, *coords + delta_coords))
+		{
+			push_interaction(state, { .type = InteractionType::plate_enter, .coords = *coords + delta_coords });
+		}
+
+		EntityHandle handle = old_tile;
+		set_tile_entity(state, old_chunk, *coords               , {}    );
+		set_tile_entity(state, new_chunk, *coords + delta_coords, handle);
+		*coords += delta_coords;
+		shift_prev_rel_pos(state, entity, delta_coords);
+	}
+	else
+	{
+		// @NOTE@ Only the hero and monstars hurt each other; bumping into anything else does nothing.
+		EntityRef new_entity = entity_of(state, new_chunk, new_tile);
+		Hero*     hero;
+		Monstar*  monstar;
+		if (deref(&hero, entity) && deref(&monstar, new_entity))
+		{
+			push_interaction(state, { .type = InteractionType::collision, .cardinal = movement, .entity = old_tile, .other = new_tile });
+			push_interaction(state, { .type = InteractionType::damage   , .amount   = 1       , .entity = new_tile                    });
+		}
+		else if (deref(&monstar, entity) && deref(&hero, new_entity))
+		{
+			u8 amount = +(monstar->flag & MonstarFlag::strong) ? 2 : 1;
+			push_interaction(state, { .type = InteractionType::collision, .cardinal = movement, .entity = old_tile, .other = new_tile });
+			push_interaction(state, { .type = InteractionType::damage   , .amount   = amount  , .entity = new_tile                    });
+		}
+	}
+}
+
+// @NOTE@ All or nothing; zero if the pool doesn't have room for all of them. The tiles have to be free.
+procedure i32 spawn_monstars(State* state, vi2* coords, i32 count, f64 previous_sim_time)
+{
+	Monstar* monstars = spawn(&state->monstars, count);
+	if (!monstars)
+	{
+		return 0;
+	}
+
+	FOR_ELEMS(monstar, monstars, count)
+	{
+		monstar->coords         = coords[monstar_index];
+		monstar->hp             = 3;
+		monstar->simulated_time = previous_sim_time;
+
+		FOR_ELEMS(META_MonstarFlag)
+		{
+			if (rng(&state->seed) < 0.5f)
+			{
+				monstar->flag |= it->flag;
+			}
+		}
+
+		aliasing hot   = state->monstars.hot;
+		i64      index = monstar - state->monstars.elems;
+		hot.existence_t [index] = 1.0f;
+		hot.hover_period[index] = +(monstar->flag & MonstarFlag::flying) ? 3.0f  : 0.0f;
+		hot.move_period [index] = +(monstar->flag & MonstarFlag::fast  ) ? 0.25f : 0.75f;
+
+		Chunk* chunk = get_or_generate_chunk(state, monstar->coords);
+		ASSERT(chunk);
+		ASSERT(!test(&chunk->occupied_bitmap, rel_coords_of(monstar->coords)));
+		if (pressure_plate_of(chunk, monstar->coords))
+		{
+			push_interaction(state, { .type = InteractionType::plate_enter, .coords = monstar->coords });
+		}
+
+		EntityHandle handle = handle_of(EntityType::Monstar, pool_index_of(&state->monstars, monstar));
+		set_tile_entity(state, chunk, monstar->coords, handle);
+		if (is_in_sim_region(&state->sim_region, monstar->coords))
+		{
+			add_to_sim_region(state, handle, previous_sim_time);
+		}
+	}
+
+	// @NOTE@ Handled right away, since a monstar stepping off its plate this update would otherwise leave it in the same batch it entered it.
+	handle_interactions(state);
+
+	return count;
+}
+
+// @NOTE@ Spread over the free tiles of the chunks around the hero, a few from each.
+procedure i32 spawn_monstar_horde(State* state, f64 previous_sim_time)
+{
+	vi2 min_chunk_coords = chunk_coords_of(state->hero.coords - vx2(SIM_REGION_RADIUS));
+	vi2 max_chunk_coords = chunk_coords_of(state->hero.coords + vx2(SIM_REGION_RADIUS));
+	vi2 chunk_counts     = (max_chunk_coords - min_chunk_coords) / CHUNK_DIM + vx2(1);
+	i32 count_per_chunk  = (MONSTAR_HORDE_COUNT + chunk_counts.x * chunk_counts.y - 1) / (chunk_counts.x * chunk_counts.y);
+
+	vi2 coords[MONSTAR_HORDE_COUNT];
+	i32 count = 0;
+	FOR_RANGE(chunk_iy, min_chunk_coords.y / CHUNK_DIM, max_chunk_coords.y / CHUNK_DIM + 1)
+	{
+		FOR_RANGE(chunk_ix, min_chunk_coords.x / CHUNK_DIM, max_chunk_coords.x / CHUNK_DIM + 1)
+		{
+			Chunk* chunk = get_or_generate_chunk(state, vi2 { chunk_ix, chunk_iy } * CHUNK_DIM);
+			if (chunk)
+			{
+				count += find_free_tiles(coords + count, min(count_per_chunk, MONSTAR_HORDE_COUNT - count), chunk);
+			}
+		}
+	}
+
+	return spawn_monstars(state, coords, count, previous_sim_time);
+}
+
+// @NOTE@ Faces the monstar toward the hero, and bobs it if it flies; true if it's time it took a step. Touches nothing but the monstar.
+procedure bool32 aim_monstar(State* state, Monstar* monstar)
+{
+	aliasing hot   = state->monstars.hot;
+	i64      index = monstar - state->monstars.elems;
+
+	if (+(monstar->flag & MonstarFlag::flying))
+	{
+		hot.rel_pos_z[index] = 2.0f + sinf(hot.hover_t[index] * TAU) * 0.5f;
+	}
+
+	vi2 delta_coords = state->hero.coords - monstar->coords;
+	if (abs(delta_coords.x) >= abs(delta_coords.y))
+	{
+		if      (delta_coords.x < 0) { monstar->cardinal = Cardinal_left;  }
+		else if (delta_coords.x > 0) { monstar->cardinal = Cardinal_right; }
+	}
+	else if (delta_coords.y < 0) { monstar->cardinal = Cardinal_down;  }
+	else if (delta_coords.y > 0) { monstar->cardinal = Cardinal_up;    }
+
+	if (hot.move_t[index] >= 1.0f)
+	{
+		hot.move_t[index] -= 1.0f;
+		return true;
+	}
+	return false;
+}
+
+// @NOTE@ For a monstar that's died and faded all the way out.
+// Anything in the sim region is still on its tile, so a monstar caught up all the way to zero still gets taken off here.
+procedure void remove_monstar(State* state, EntityHandle handle, Monstar* monstar)
+{
+	Chunk* chunk = find_chunk(state, monstar->coords);
+	ASSERT(chunk);
+	if (pressure_plate_of(chunk, monstar->coords))
+	{
+		push_interaction(state, { .type = InteractionType::plate_leave, .coords = monstar->coords });
+	}
+	set_tile_entity(state, chunk, monstar->coords, {});
+	despawn(&state->monstars, index_of(handle));
+}
+
+// @NOTE@ Despawning straight from the pool would leave each monstar's handle on its tile, and the tile blocked for good.
+procedure void remove_monstars(State* state, u32* indices, i32 count)
+{
+	FOR_ELEMS(it, indices, count)
+	{
+		Monstar* monstar = find(&state->monstars, *it);
+		ASSERT(monstar);
+		remove_monstar(state, handle_of(EntityType::Monstar, *it), monstar);
+	}
+}
+
+// @NOTE@ True if a step from the next chunk over could reach the tile.
+procedure bool32 is_on_chunk_edge(vi2 coords)
+{
+	vi2 rel_coords = rel_coords_of(coords);
+	return rel_coords.x == 0 || rel_coords.x == CHUNK_DIM - 1 || rel_coords.y == 0 || rel_coords.y == CHUNK_DIM - 1;
+}
+
+// @NOTE@ Steps the job's monstars as far as can be done touching nothing but them and the tiles inside their chunk, off the edge;
+// no other job touches those, so the jobs can go in any order, all at once. Whatever's left over is noted in `MonstarSteps::steps`.
+// Deferred steps get done after every step that wasn't, so a step that touches a tile an earlier deferred step did is deferred too, to keep them in order.
+procedure void step_monstars(MonstarStepJob* job)
+{
+	State*     state    = job->state;
+	Chunk*     chunk    = job->chunk;
+	aliasing   steps    = state->monstar_steps;
+	TileBitmap deferred = {};
+
+	lambda defer =
+		[&](MonstarStep* step, vi2 coords, vi2 new_coords)
+		{
+			if (chunk_coords_of(coords) == chunk->coords)
+			{
+				set(&deferred, rel_coords_of(coords), true);
+			}
+			if (chunk_coords_of(new_coords) == chunk->coords)
+			{
+				set(&deferred, rel_coords_of(new_coords), true);
+			}
+			*step = MonstarStep::deferred;
+		};
+
+	FOR_ELEMS(it, &steps.entities[job->first_entity], job->entity_count)
+	{
+		Monstar* monstar = find(&state->monstars, index_of(state->sim_region.entities.Monstar_[*it]));
+		aliasing step    = steps.steps[*it];
+		ASSERT(monstar && chunk_coords_of(monstar->coords) == chunk->coords);
+
+		if (monstar->hp)
+		{
+			if (!aim_monstar(state, monstar))
+			{
+				continue;
+			}
+
+			vi2 new_coords = monstar->coords + META_Cardinal[monstar->cardinal].vi;
+			if
+			(
+				(is_on_chunk_edge(monstar->coords) || is_on_chunk_edge(new_coords))                             ||
+				(test(&deferred, rel_coords_of(monstar->coords)) || test(&deferred, rel_coords_of(new_coords))) ||
+				(pressure_plate_of(chunk, monstar->coords) || pressure_plate_of(chunk, new_coords))
+			)
+			{
+				defer(&step, monstar->coords, new_coords);
+			}
+			else if (test(&chunk->occupied_bitmap, rel_coords_of(new_coords)))
+			{
+				// @NOTE@ Bumping into the hero hurts it; bumping into anything else does nothing.
+				if (type_of(chunk->tiles[rel_coords_of(new_coords).y][rel_coords_of(new_coords).x]) == EntityType::Hero)
+				{
+					defer(&step, monstar->coords, new_coords);
+				}
+			}
+			else
+			{
+				// @NOTE@ What `move` does, bar marking the chunk changed.
+				EntityHandle handle = chunk->tiles[rel_coords_of(monstar->coords).y][rel_coords_of(monstar->coords).x];
+				put_tile_entity(chunk, monstar->coords, {}    );
+				put_tile_entity(chunk, new_coords     , handle);
+				shift_prev_rel_pos(state, ref(monstar), new_coords - monstar->coords);
+				monstar->coords = new_coords;
+				step            = MonstarStep::moved;
+			}
+		}
+		else if (state->monstars.hot.existence_t[monstar - state->monstars.elems] == 0.0f)
+		{
+			if (is_on_chunk_edge(monstar->coords) || test(&deferred, rel_coords_of(monstar->coords)) || pressure_plate_of(chunk, monstar->coords))
+			{
+				defer(&step, monstar->coords, monstar->coords);
+			}
+			else
+			{
+				put_tile_entity(chunk, monstar->coords, {});
+				step = MonstarStep::despawned;
+			}
+		}
+	}
+}
+
+procedure PlatformWork_t(step_monstars_work)
+{
+	MonstarStepJob* job = reinterpret_cast<MonstarStepJob*>(platform_work_data);
+	if (claim_job(job))
+	{
+		step_monstars(job);
+		__atomic_store_n(&job->done, true, __ATOMIC_RELEASE);
+	}
+}
+
+// @NOTE@ Only the monstars in the sim region; the ones that die are despawned, which keeps the pool dense.
+// Their timers and offsets go first, all together, then each one that's alive decides where it's going. With enough of them, and `PlatformPushWork`,
+// they're stepped a chunk at a time on the worker threads, then what couldn't be done inside a chunk is done in the sim region's order on the main thread;
+// either way it comes out exactly as if they'd all been stepped one after another on the main thread, change generations and all.
+procedure void update_monstars(State* state, f32 delta_time, PlatformPushWork_t* PlatformPushWork)
+{
+	aliasing pool   = state->monstars;
+	aliasing region = state->sim_region;
+	aliasing steps  = state->monstar_steps;
+
+	memset(pool.hot.update, 0, static_cast<u64>(pool.count + 3) / 4 * 4 * sizeof(u32));
+	FOR_Entity_Monstar(it, &region.entities)
+	{
+		Monstar* monstar = find(&pool, index_of(*it));
+		if (monstar)
+		{
+			pool.hot.update[monstar - pool.elems] = static_cast<u32>(monstar->hp ? MonstarUpdate::alive : MonstarUpdate::dying);
+		}
+	}
+
+	integrate_monstars(&pool.hot, pool.count, delta_time);
+
+	// @NOTE@ Whatever they bumped into or stepped on is dealt with once they've all moved.
+	DEFER { handle_interactions(state); };
+
+	if (!PlatformPushWork || region.entity_count < MONSTAR_STEP_PARALLEL_MIN)
+	{
+		FOR_Entity_Monstar(it, &region.entities)
+		{
+			Monstar* monstar = find(&pool, index_of(*it));
+			if (!monstar)
+			{
+				continue;
+			}
+
+			if (monstar->hp)
+			{
+				if (aim_monstar(state, monstar))
+				{
+					move(state, ref(monstar), monstar->cardinal);
+				}
+			}
+			else if (pool.hot.existence_t[monstar - pool.elems] == 0.0f)
+			{
+				remove_monstar(state, *it, monstar);
+			}
+		}
+		return;
+	}
+
+	//
+	// Sort the monstars into a job per chunk.
+	//
+
+	steps.job_count = 0;
+	i32 job_index   = 0;
+	FOR_Entity_Monstar(it, &region.entities)
+	{
+		steps.steps[it_index] = MonstarStep::none;
+
+		Monstar* monstar = find(&pool, index_of(*it));
+		if (!monstar)
+		{
+			steps.entity_jobs[it_index] = 0xFF;
+			continue;
+		}
+
+		// @NOTE@ The sim region's gathered a chunk at a time, so it's nearly always the same chunk as the last monstar's.
+		vi2 chunk_coords = chunk_coords_of(monstar->coords);
+		if (job_index == steps.job_count || steps.jobs[job_index].chunk->coords != chunk_coords)
+		{
+			job_index = 0;
+			while (job_index < steps.job_count && steps.jobs[job_index].chunk->coords != chunk_coords)
+			{
+				job_index += 1;
+			}
+			if (job_index == steps.job_count)
+			{
+				// @NOTE@ Creatures only ever get into the sim region from its own chunks.
+				ASSERT(steps.job_count < capacityof(steps.jobs));
+				steps.jobs[job_index].chunk        = find_chunk(state, chunk_coords);
+				steps.jobs[job_index].entity_count = 0;
+				steps.job_count                   += 1;
+				ASSERT(steps.jobs[job_index].chunk);
+			}
+		}
+
+		steps.entity_jobs[it_index]         = static_cast<u8>(job_index);
+		steps.jobs[job_index].entity_count += 1;
+	}
+
+	i32 first_entity = 0;
+	FOR_ELEMS(job, steps.jobs, steps.job_count)
+	{
+		job->first_entity  = first_entity;
+		first_entity      += job->entity_count;
+		job->entity_count  = 0;
+	}
+	FOR_ELEMS(it, steps.entity_jobs, region.entities.counts[static_cast<i32>(EntityType::Monstar)])
+	{
+		if (*it != 0xFF)
 		{
-			CHUNK_DIM * (coords.x / CHUNK_DIM + (coords.x < 0 && coords.x % CHUNK_DIM ? -1 : 0)),
-			CHUNK_DIM * (coords.y / CHUNK_DIM + (coords.y < 0 && coords.y % CHUNK_DIM ? -1 : 0))
-		};
+			aliasing job = steps.jobs[*it];
+			steps.entities[job.first_entity + job.entity_count]  = static_cast<u16>(it_index);
+			job.entity_count                                    += 1;
+		}
+	}
+
+	//
+	// Step each chunk's monstars.
+	//
 
-	i64 hash = mod(static_cast<i64>(chunk_coords.x * 17 + chunk_coords.y * 13 - 19), capacityof(state->chunk_hashtable));
+	FOR_ELEMS(job, steps.jobs, steps.job_count)
+	{
+		job->state = state;
+		push_job(PlatformPushWork, step_monstars_work, job); // @NOTE@ If the queue's full, the main thread gets to it below.
+	}
 
-	FOR_RANGE(capacityof(state->chunk_hashtable))
+	// @NOTE@ From the back, since the workers take them from the front.
+	FOR_RANGE_REV(job_index, steps.job_count)
 	{
-		if (!state->chunk_hashtable[hash].exists)
+		MonstarStepJob* job = &steps.jobs[job_index];
+		if (claim_job_or_wait(job))
 		{
-			state->chunk_hashtable[hash].exists = true;
-			state->chunk_hashtable[hash].coords = chunk_coords;
+			step_monstars(job);
 		}
-		if (state->chunk_hashtable[hash].coords == chunk_coords)
+	}
+
+	//
+	// Finish every step in the sim region's order.
+	//
+
+	FOR_Entity_Monstar(it, &region.entities)
+	{
+		switch (steps.steps[it_index])
 		{
-			return &state->chunk_hashtable[hash];
-		}
+			case MonstarStep::none:
+			{
+			} break;
 
-		hash = mod(hash + 1, capacityof(state->chunk_hashtable));
-	}
+			case MonstarStep::moved:
+			{
+				Chunk* chunk = steps.jobs[steps.entity_jobs[it_index]].chunk;
+				mark_chunk_changed(state, chunk);
+				mark_chunk_changed(state, chunk);
+			} break;
 
-	return 0;
+			case MonstarStep::despawned:
+			{
+				mark_chunk_changed(state, steps.jobs[steps.entity_jobs[it_index]].chunk);
+				despawn(&pool, index_of(*it));
+			} break;
+
+			case MonstarStep::deferred:
+			{
+				Monstar* monstar = find(&pool, index_of(*it));
+				ASSERT(monstar);
+				if (monstar->hp)
+				{
+					move(state, ref(monstar), monstar->cardinal);
+				}
+				else
+				{
+					remove_monstar(state, *it, monstar);
+				}
+			} break;
+		}
+	}
 }
 
-PlatformUpdate_t(PlatformUpdate)
+PlatformSimulate_t(PlatformSimulate)
 {
 	State*      state = reinterpret_cast<State     *>(platform_memory                );
 	TransState* trans = reinterpret_cast<TransState*>(platform_memory + sizeof(State));
@@ -251,6 +1768,10 @@ PlatformUpdate_t(PlatformUpdate)
 				.size = STATE_SIZE      - sizeof(State),
 				.data = platform_memory + sizeof(State)
 			};
+		state->streaming.radius = STREAMING_DEFAULT_RADIUS;
+
+		// @NOTE@ Sized up front so walking around at the default radius never has to grow the chunk map.
+		reserve(&state->chunk_map, &state->arena, STREAMING_RESIDENT_CHUNK_COUNT);
 
 		//
 		// Load BMPs.
@@ -316,11 +1837,10 @@ PlatformUpdate_t(PlatformUpdate)
 			bmp->dims = header.dims;
 			bmp->rgba = allocate<u32>(&state->arena, bmp->dims.x * bmp->dims.y);
 
-			// @TODO@ Microsoft specific intrinsic...
-			u32 lz_r = __lzcnt(header.mask_r);
-			u32 lz_g = __lzcnt(header.mask_g);
-			u32 lz_b = __lzcnt(header.mask_b);
-			u32 lz_a = __lzcnt(header.mask_a);
+			u32 lz_r = count_leading_zeros(header.mask_r);
+			u32 lz_g = count_leading_zeros(header.mask_g);
+			u32 lz_b = count_leading_zeros(header.mask_b);
+			u32 lz_a = count_leading_zeros(header.mask_a);
 			FOR_RANGE(y, header.dims.y)
 			{
 				FOR_RANGE(x, header.dims.x)
@@ -337,6 +1857,8 @@ PlatformUpdate_t(PlatformUpdate)
 			}
 		}
 
+		state->world_arena_used = state->arena.used;
+
 		//
 		// Initializes entities.
 		//
@@ -344,43 +1866,23 @@ PlatformUpdate_t(PlatformUpdate)
 		{
 			state->hero.coords = { 0, 0 };
 			state->hero.hp     = 4;
-			Chunk* chunk = get_chunk(state, state->hero.coords);
-			ASSERT(chunk->tiles[state->hero.coords.y][state->hero.coords.x].entity.ref_type == EntityType::null);
-			chunk->tiles[state->hero.coords.y][state->hero.coords.x].entity = ref(&state->hero);
+			Chunk* chunk = get_or_generate_chunk(state, state->hero.coords);
+			ASSERT(!test(&chunk->occupied_bitmap, rel_coords_of(state->hero.coords)));
+			set_tile_entity(state, chunk, state->hero.coords, handle_of(EntityType::Hero));
 		}
 
 		{
 			state->pet.coords = { 3, 3 };
-			Chunk* chunk = get_chunk(state, state->pet.coords);
-			ASSERT(chunk->tiles[state->pet.coords.y][state->pet.coords.x].entity.ref_type == EntityType::null);
-			chunk->tiles[state->pet.coords.y][state->pet.coords.x].entity = ref(&state->pet);
+			Chunk* chunk = get_or_generate_chunk(state, state->pet.coords);
+			ASSERT(!test(&chunk->occupied_bitmap, rel_coords_of(state->pet.coords)));
+			set_tile_entity(state, chunk, state->pet.coords, handle_of(EntityType::Pet));
 		}
 
 		{
 			state->pressure_plate.coords = { 1, 3 };
-			Chunk* chunk = get_chunk(state, state->pressure_plate.coords);
-			ASSERT(!chunk->tiles[state->pressure_plate.coords.y][state->pressure_plate.coords.x].pressure_plate);
-			chunk->tiles[state->pressure_plate.coords.y][state->pressure_plate.coords.x].pressure_plate = &state->pressure_plate;
-		}
-
-		FOR_RANGE(chunk_iy, -4, 4)
-		{
-			FOR_RANGE(chunk_ix, -4, 4)
-			{
-				Chunk* chunk = get_chunk(state, { chunk_ix * CHUNK_DIM, chunk_iy * CHUNK_DIM });
-				chunk->tree_count = rng(&state->seed, static_cast<i32>(capacityof(chunk->tree_buffer)) / 2, static_cast<i32>(capacityof(chunk->tree_buffer)));
-				FOR_ELEMS(it, chunk->tree_buffer, chunk->tree_count)
-				{
-					do
-					{
-						it->coords = chunk->coords + vi2 { rng(&state->seed, 0, CHUNK_DIM), rng(&state->seed, 0, CHUNK_DIM) };
-					}
-					while (chunk->tiles[it->coords.y - chunk->coords.y][it->coords.x - chunk->coords.x].entity.ref_type != EntityType::null);
-					chunk->tiles[it->coords.y - chunk->coords.y][it->coords.x - chunk->coords.x].entity = ref(it);
-
-					it->bmp_index = static_cast<i32>(rng(&state->seed, capacityof(state->bmp.trees)));
-				}
-			}
+			Chunk* chunk = get_or_generate_chunk(state, state->pressure_plate.coords);
+			ASSERT(!pressure_plate_of(chunk, state->pressure_plate.coords));
+			set_tile_pressure_plate(state, chunk, state->pressure_plate.coords, &state->pressure_plate);
 		}
 	}
 	if (!trans->inited)
@@ -438,104 +1940,42 @@ PlatformUpdate_t(PlatformUpdate)
 	}
 
 	//
-	// Update.
+	// Save and load.
 	//
 
-	lambda move =
-		[&](EntityRef entity, Cardinal movement)
+	if (BTN_PRESSES(.numbers[5]))
+	{
+		if (!save_world(state, &trans->arena, String(EXE_DIR "world.sav"), PlatformReadFileData, PlatformFreeFileData, PlatformWriteFile))
 		{
-			vi2* coords;
-			//vf3* rel_pos;
-			switch (entity.ref_type)
-			{
-				case EntityType::Hero:
-				{
-					coords  = &entity.Hero_->coords;
-					//rel_pos = &entity.Hero_->rel_pos;
-				} break;
-
-				case EntityType::Pet:
-				{
-					coords  = &entity.Pet_->coords;
-					//rel_pos = &entity.Pet_->rel_pos;
-				} break;
-
-				case EntityType::Monstar:
-				{
-					coords  = &entity.Monstar_->coords;
-					//rel_pos = &entity.Monstar_->rel_pos;
-				} break;
-
-				case EntityType::null:
-				case EntityType::Tree:
-				case EntityType::PressurePlate:
-				{
-					ASSERT(false);
-					return;
-				} break;
-			}
-
-			vi2 delta_coords = META_Cardinal[movement].vi;
+			DEBUG_printf(__FILE__ " :: Failed to save the world.\n");
+		}
+	}
 
-			Chunk* old_chunk = get_chunk(state, *coords               );
-			Chunk* new_chunk = get_chunk(state, *coords + delta_coords);
+	if (BTN_PRESSES(.numbers[9]))
+	{
+		if (!load_world(state, String(EXE_DIR "world.sav"), PlatformMapFileData, PlatformUnmapFileData, PlatformFreeFileData, PlatformWriteFile))
+		{
+			DEBUG_printf(__FILE__ " :: Failed to load the world.\n");
+		}
+	}
 
-			ASSERT(IN_RANGE(coords->x + - old_chunk->coords.x, 0, CHUNK_DIM));
-			ASSERT(IN_RANGE(coords->y + - old_chunk->coords.y, 0, CHUNK_DIM));
-			aliasing old_tile  = old_chunk->tiles[coords->y - old_chunk->coords.y][coords->x - old_chunk->coords.x];
+	//
+	// Update.
+	//
 
-			ASSERT(IN_RANGE(coords->x + delta_coords.x - new_chunk->coords.x, 0, CHUNK_DIM));
-			ASSERT(IN_RANGE(coords->y + delta_coords.y - new_chunk->coords.y, 0, CHUNK_DIM));
-			aliasing new_tile  = new_chunk->tiles[coords->y + delta_coords.y - new_chunk->coords.y][coords->x + delta_coords.x - new_chunk->coords.x];
+	state->last_found_chunk = 0;
+	memset(state->interactions.counts, 0, sizeof(state->interactions.counts));
 
-			ASSERT(old_tile.entity.ref_type != EntityType::null);
-			if (new_tile.entity.ref_type == EntityType::null)
-			{
-				if (old_tile.pressure_plate)
-				{
-					ASSERT(old_tile.pressure_plate->pressed);
-					old_tile.pressure_plate->pressed = false;
-				}
-				if (new_tile.pressure_plate)
-				{
-					ASSERT(!new_tile.pressure_plate->pressed);
-					new_tile.pressure_plate->pressed = true;
-				}
+	f64 previous_sim_time = state->sim_time;
+	state->sim_time += platform_delta_time;
 
-				*coords += delta_coords;
-				old_tile.entity = {};
-				new_tile.entity = entity;
-			}
-			else
-			{
-				{
-					Hero*    hero;
-					Monstar* monstar;
-					if (deref(&hero, entity) && deref(&monstar, new_tile.entity))
-					{
-						hero->rel_pos.xy += delta_coords / 2.0f;
-						monstar->hp       = max(monstar->hp - 1, 0);
-					}
-				}
-				{
-					Monstar* monstar;
-					Hero*    hero;
-					if (deref(&monstar, entity) && deref(&hero, new_tile.entity))
-					{
-						monstar->rel_pos.xy += delta_coords / 2.0f;
-
-						if (+(monstar->flag & MonstarFlag::strong))
-						{
-							hero->hp = max(hero->hp - 2, 0);
-						}
-						else
-						{
-							hero->hp = max(hero->hp - 1, 0);
-						}
-					}
-				}
-			}
-		};
+	// @NOTE@ Render interpolates from these to wherever this update leaves things.
+	state->hero.prev_rel_pos   = state->hero.rel_pos;
+	state->pet.prev_rel_pos    = state->pet.rel_pos;
+	state->camera_prev_rel_pos = state->camera_rel_pos;
+	memcpy(state->monstars.hot.prev_rel_pos_x, state->monstars.hot.rel_pos_x, static_cast<u64>(state->monstars.count) * sizeof(f32));
+	memcpy(state->monstars.hot.prev_rel_pos_y, state->monstars.hot.rel_pos_y, static_cast<u64>(state->monstars.count) * sizeof(f32));
+	memcpy(state->monstars.hot.prev_rel_pos_z, state->monstars.hot.rel_pos_z, static_cast<u64>(state->monstars.count) * sizeof(f32));
 
 	//
 	// Update hero.
@@ -549,153 +1989,164 @@ PlatformUpdate_t(PlatformUpdate)
 			else if (delta_coords.x > 0) { state->hero.cardinal = Cardinal_right; }
 			else if (delta_coords.y < 0) { state->hero.cardinal = Cardinal_down;  }
 			else if (delta_coords.y > 0) { state->hero.cardinal = Cardinal_up;    }
-			move(ref(&state->hero), state->hero.cardinal);
+			move(state, ref(&state->hero), state->hero.cardinal);
+			handle_interactions(state);
 		}
+
+		state->hero.rel_pos.xy = dampen(state->hero.rel_pos.xy, { 0.0f, 0.0f }, 0.01f, platform_delta_time);
 	}
 
 	//
-	// Update pet.
+	// Gather sim region.
+	//
+
+	begin_sim_region(state, previous_sim_time);
+
+	//
+	// Update pets.
 	//
 
+	FOR_Entity_Pet(it, &state->sim_region.entities)
 	{
-		state->hero.rel_pos.xy = dampen(state->hero.rel_pos.xy, { 0.0f, 0.0f }, 0.01f, platform_delta_time);
+		Pet* pet = &state->pet;
+		ASSERT(index_of(*it) == 0);
 
-		state->pet.hover_t += platform_delta_time / 2.0f;
-		if (state->pet.hover_t >= 1.0f)
+		pet->hover_t += platform_delta_time / 2.0f;
+		if (pet->hover_t >= 1.0f)
 		{
-			state->pet.hover_t -= 1.0f;
+			pet->hover_t -= 1.0f;
 		}
-		state->pet.rel_pos.z = 1.0f + sinf(state->pet.hover_t * TAU) * 0.25f;
+		pet->rel_pos.z = 1.0f + sinf(pet->hover_t * TAU) * 0.25f;
 
-		vi2 delta_coords = state->hero.coords - state->pet.coords;
+		vi2 delta_coords = state->hero.coords - pet->coords;
 		if (abs(delta_coords.x) >= abs(delta_coords.y))
 		{
-			if      (delta_coords.x < 0) { state->pet.cardinal = Cardinal_left;  }
-			else if (delta_coords.x > 0) { state->pet.cardinal = Cardinal_right; }
+			if      (delta_coords.x < 0) { pet->cardinal = Cardinal_left;  }
+			else if (delta_coords.x > 0) { pet->cardinal = Cardinal_right; }
 		}
-		else if (delta_coords.y < 0) { state->pet.cardinal = Cardinal_down;  }
-		else if (delta_coords.y > 0) { state->pet.cardinal = Cardinal_up;    }
+		else if (delta_coords.y < 0) { pet->cardinal = Cardinal_down;  }
+		else if (delta_coords.y > 0) { pet->cardinal = Cardinal_up;    }
 
-		state->pet.move_t += platform_delta_time / 0.5f;
-		if (state->pet.move_t >= 1.0f)
+		pet->move_t += platform_delta_time / 0.5f;
+		if (pet->move_t >= 1.0f)
 		{
 			if (max(abs(delta_coords.x), abs(delta_coords.y)) <= 2)
 			{
-				state->pet.move_t = 1.0f;
+				pet->move_t = 1.0f;
 			}
 			else
 			{
 				delta_coords = { sign(delta_coords.x), sign(delta_coords.y) };
-				state->pet.move_t -= 1.0f;
-				move(ref(&state->pet), state->pet.cardinal);
+				pet->move_t -= 1.0f;
+				move(state, ref(pet), pet->cardinal);
 			}
 		}
 	}
 
+	handle_interactions(state);
+
 	//
-	// Update monstar.
+	// Update monstars.
 	//
 
-	if (state->pressure_plate.pressed && state->monstar.existence_t == 0.0f)
+	if (state->pressure_plate.pressed && !state->monstars.count)
 	{
-		state->monstar             = {};
-		state->monstar.coords      = { 5, 5 };
-		state->monstar.hp          = 3;
-		state->monstar.existence_t = 1.0f;
-
-		FOR_ELEMS(META_MonstarFlag)
+		// @NOTE@ Takes the first free tile of the chunk instead if something's standing on the spawn point.
+		vi2    coords = { 5, 5 };
+		Chunk* chunk  = get_or_generate_chunk(state, coords);
+		ASSERT(chunk);
+		if (test(&chunk->occupied_bitmap, rel_coords_of(coords)))
 		{
-			if (rng(&state->seed) < 0.5f)
-			{
-				state->monstar.flag |= it->flag;
-			}
+			i32 free_tile_count = find_free_tiles(&coords, 1, chunk);
+			ASSERT(free_tile_count);
 		}
 
-		Chunk* chunk = get_chunk(state, state->monstar.coords);
-		ASSERT(chunk->tiles[state->monstar.coords.y][state->monstar.coords.x].entity.ref_type == EntityType::null);
-		chunk->tiles[state->monstar.coords.y][state->monstar.coords.x].entity = ref(&state->monstar);
+		i32 spawned_count = spawn_monstars(state, &coords, 1, previous_sim_time);
+		ASSERT(spawned_count == 1);
 	}
 
-	if (state->monstar.existence_t != 0.0f)
+	if (BTN_PRESSES(.numbers[7]))
 	{
-		if (state->monstar.hp)
-		{
-			state->monstar.rel_pos.xy = dampen(state->monstar.rel_pos.xy, { 0.0f, 0.0f }, 0.01f, platform_delta_time);
-
-			if (+(state->monstar.flag & MonstarFlag::flying))
-			{
-				state->monstar.hover_t += platform_delta_time / 3.0f;
-				if (state->monstar.hover_t >= 1.0f)
-				{
-					state->monstar.hover_t -= 1.0f;
-				}
-				state->monstar.rel_pos.z = 2.0f + sinf(state->monstar.hover_t * TAU) * 0.5f;
-			}
-
-			vi2 delta_coords = state->hero.coords - state->monstar.coords;
-			if (abs(delta_coords.x) >= abs(delta_coords.y))
-			{
-				if      (delta_coords.x < 0) { state->monstar.cardinal = Cardinal_left;  }
-				else if (delta_coords.x > 0) { state->monstar.cardinal = Cardinal_right; }
-			}
-			else if (delta_coords.y < 0) { state->monstar.cardinal = Cardinal_down;  }
-			else if (delta_coords.y > 0) { state->monstar.cardinal = Cardinal_up;    }
-
-			if (+(state->monstar.flag & MonstarFlag::fast))
-			{
-				state->monstar.move_t += platform_delta_time / 0.25f;
-			}
-			else
-			{
-				state->monstar.move_t += platform_delta_time / 0.75f;
-			}
-			if (state->monstar.move_t >= 1.0f)
-			{
-				delta_coords = { sign(delta_coords.x), sign(delta_coords.y) };
-				state->monstar.move_t -= 1.0f;
-				move(ref(&state->monstar), state->monstar.cardinal);
-			}
-		}
-		else
+		if (!spawn_monstar_horde(state, previous_sim_time))
 		{
-			state->monstar.existence_t = max(state->monstar.existence_t - platform_delta_time / 1.0f, 0.0f);
-			state->monstar.rel_pos.z  = dampen(state->monstar.rel_pos.z, 0.0f, 0.1f, platform_delta_time);
-
-			if (state->monstar.existence_t == 0.0f)
-			{
-				Chunk*   chunk = get_chunk(state, state->monstar.coords);
-				aliasing tile  = chunk->tiles[state->monstar.coords.y - chunk->coords.y][state->monstar.coords.x - chunk->coords.x];
-				tile.entity = {};
-				if (tile.pressure_plate)
-				{
-					ASSERT(tile.pressure_plate->pressed);
-					tile.pressure_plate->pressed = false;
-				}
-			}
+			DEBUG_printf(__FILE__ " :: No room for a horde of monstars.\n");
 		}
 	}
 
+	update_monstars(state, platform_delta_time, PlatformPushWork);
+
+	end_sim_region(state);
+
 	//
 	// Update camera.
 	//
 
 	{
 		vi2 delta_coords = HJKL_PRESSES();
-		state->camera_coords  += delta_coords;
-		state->camera_rel_pos -= delta_coords;
-		state->camera_rel_pos  = dampen(state->camera_rel_pos, { 0.0f, 0.0f }, 0.001f, platform_delta_time);
+		state->camera_coords       += delta_coords;
+		state->camera_rel_pos      -= delta_coords;
+		state->camera_prev_rel_pos -= delta_coords;
+		state->camera_rel_pos       = dampen(state->camera_rel_pos, { 0.0f, 0.0f }, 0.001f, platform_delta_time);
 	}
 
 	//
-	// Render.
+	// Generate chunks.
+	//
+
+	update_generation(state, PlatformPushWork);
+
+	//
+	// Stream chunks.
+	//
+
+	update_streaming(state, PlatformReadFileData, PlatformFreeFileData, PlatformWriteFile, PlatformPushWork);
+
+	//
+	// Compress cold chunks.
+	//
+
+	update_cold_chunks(state);
+
+	//
+	// Toggle views.
 	//
 
+	if (LTR_PRESSES('m'))
+	{
+		trans->world_map_mode = !trans->world_map_mode;
+	}
+
+	if (LTR_PRESSES('o'))
+	{
+		trans->overdraw_mode = !trans->overdraw_mode;
+	}
+
+	return PlatformUpdateExitCode::normal;
+}
+
+PlatformRender_t(PlatformRender)
+{
+	State*      state = reinterpret_cast<State     *>(platform_memory                );
+	TransState* trans = reinterpret_cast<TransState*>(platform_memory + sizeof(State));
+	ASSERT(state->inited && trans->inited);
+
+	ASSERT(platform_framebuffer->format == PLATFORM_GAME_PIXEL_FORMAT);
+	ASSERT(platform_framebuffer->stride == platform_framebuffer->dims.x);
 	BMP screen = { platform_framebuffer->dims, platform_framebuffer->pixels };
 
+	// @NOTE@ Done as `rel_pos` plus a fraction of the difference so that an alpha of one comes out as exactly `rel_pos`.
+	lambda blend =
+		[&](vf3 prev_rel_pos, vf3 rel_pos)
+		{
+			return rel_pos + (prev_rel_pos - rel_pos) * (1.0f - platform_alpha);
+		};
+
+	vf2 camera_rel_pos = blend(vxn(state->camera_prev_rel_pos, 0.0f), vxn(state->camera_rel_pos, 0.0f)).xy;
+
 	lambda screen_coords_of =
 		[&](vi2 coords, vf3 rel_pos)
 		{
-			return vxx((coords - state->camera_coords + rel_pos.xy - state->camera_rel_pos) * PIXELS_PER_METER + screen.dims / 2.0f + vf2 { 0.0f, rel_pos.z * PIXELS_PER_Z });
+			return vxx((coords - state->camera_coords + rel_pos.xy - camera_rel_pos) * PIXELS_PER_METER + screen.dims / 2.0f + vf2 { 0.0f, rel_pos.z * PIXELS_PER_Z });
 		};
 
 	lambda draw_hp =
@@ -714,77 +2165,236 @@ PlatformUpdate_t(PlatformUpdate)
 			}
 		};
 
-	memset(screen.rgba, 32, static_cast<u64>(screen.dims.x * screen.dims.y) * sizeof(u32));
-
-	FOR_ELEMS(it, trans->cached_ground_bmps, CACHED_GROUND_BMP_CAPACITY)
+	if (trans->overdraw_mode)
 	{
-		if (it->exists)
+		if (!trans->overdraw_map.counts)
 		{
-			draw_bmp(screen, { CACHED_GROUND_BMP_DIMS, it->rgba }, screen_coords_of(it->coords, { 0.0f, 0.0f, 0.0f }));
+			trans->overdraw_map.dims   = screen.dims;
+			trans->overdraw_map.counts = allocate<u16>(&trans->arena, screen.dims.x * screen.dims.y);
+			ASSERT(trans->overdraw_map.counts);
 		}
+		ASSERT(trans->overdraw_map.dims == screen.dims); // @TODO@ Resizable framebuffer.
+
+		trans->overdraw_map.target = screen.rgba;
+		memset(trans->overdraw_map.counts, 0, static_cast<u64>(screen.dims.x * screen.dims.y) * sizeof(u16));
+		g_overdraw_map = &trans->overdraw_map;
 	}
+	DEFER { g_overdraw_map = 0; };
 
-	//
-	// Render trees.
-	//
+	memset(screen.rgba, 32, static_cast<u64>(screen.dims.x * screen.dims.y) * sizeof(u32));
 
-	// @TODO@ Render what's visible.
-	FOR_RANGE(chunk_iy, -4, 4)
+	if (trans->world_map_mode)
 	{
-		FOR_RANGE(chunk_ix, -4, 4)
+		//
+		// Render world map.
+		//
+
+		// @NOTE@ Drawn entirely from the chunk summaries; the tiles, trees, and ground cache are never touched.
+		constexpr i32 WORLD_MAP_PIXELS_PER_TILE = 4;
+		constexpr i32 WORLD_MAP_CHUNK_DIM       = CHUNK_DIM * WORLD_MAP_PIXELS_PER_TILE;
+
+		lambda origin_of =
+			[&](vi2 chunk_coords)
+			{
+				return screen.dims / 2 + (chunk_coords - state->camera_coords) * WORLD_MAP_PIXELS_PER_TILE;
+			};
+
+		lambda is_on_screen =
+			[&](vi2 origin)
+			{
+				return !
+				(
+					origin.x + WORLD_MAP_CHUNK_DIM <= 0 || origin.x >= screen.dims.x ||
+					origin.y + WORLD_MAP_CHUNK_DIM <= 0 || origin.y >= screen.dims.y
+				);
+			};
+
+		lambda draw_summary =
+			[&](vi2 origin, ChunkSummary* summary)
+			{
+				FOR_RANGE(y, CHUNK_DIM)
+				{
+					FOR_RANGE(x, CHUNK_DIM)
+					{
+						draw_rect(screen, origin + vi2 { x, y } * WORLD_MAP_PIXELS_PER_TILE + vx2(WORLD_MAP_PIXELS_PER_TILE / 2), vx2(WORLD_MAP_PIXELS_PER_TILE), summary->thumbnail[y][x]);
+					}
+				}
+
+				// @NOTE@ Density strips along the bottom of the chunk; trees saturate at `CHUNK_GENERATED_TREE_MAX`, creatures at `DENSITY_STRIP_CREATURE_MAX`.
+				constexpr i32 DENSITY_STRIP_HEIGHT       = 1;
+				constexpr i32 DENSITY_STRIP_CREATURE_MAX = 4;
+				i32 tree_strip_width     = summary->tree_count     * WORLD_MAP_CHUNK_DIM / CHUNK_GENERATED_TREE_MAX;
+				i32 creature_strip_width = summary->creature_count * WORLD_MAP_CHUNK_DIM / DENSITY_STRIP_CREATURE_MAX;
+				tree_strip_width     = min(tree_strip_width    , WORLD_MAP_CHUNK_DIM);
+				creature_strip_width = min(creature_strip_width, WORLD_MAP_CHUNK_DIM);
+				draw_rect(screen, origin + vi2 { tree_strip_width     / 2,     DENSITY_STRIP_HEIGHT }, { tree_strip_width    , DENSITY_STRIP_HEIGHT }, rgba_from(0.6f, 0.9f, 0.3f));
+				draw_rect(screen, origin + vi2 { creature_strip_width / 2, 2 * DENSITY_STRIP_HEIGHT }, { creature_strip_width, DENSITY_STRIP_HEIGHT }, rgba_from(0.9f, 0.3f, 0.3f));
+			};
+
+		FOR_ELEMS(slot, state->chunk_map.slots, state->chunk_map.capacity)
+		{
+			if (slot->distance && is_on_screen(origin_of(slot->value->coords)))
+			{
+				draw_summary(origin_of(slot->value->coords), &slot->value->summary);
+			}
+		}
+
+		// @NOTE@ Cold chunks don't keep a summary, but it's quick to make one from their trees for the few that are on screen.
+		FOR_ELEMS(slot, state->cold_chunks.chunks.slots, state->cold_chunks.chunks.capacity)
 		{
-			Chunk* chunk = get_chunk(state, { chunk_ix * CHUNK_DIM, chunk_iy * CHUNK_DIM });
-			FOR_ELEMS(it, chunk->tree_buffer, chunk->tree_count)
+			if (slot->distance && is_on_screen(origin_of(slot->value->packed.coords)))
 			{
-				draw_rect_outline(screen, screen_coords_of(it->coords, { 0.0f, 0.0f, 0.0f }), vxx(vf2 { 1.0f, 1.0f } * PIXELS_PER_METER), rgba_from(0.1f, 0.3f, 0.1f));
-				draw_bmp(screen, state->bmp.trees[it->bmp_index], screen_coords_of(it->coords, { 0.0f, 0.0f, 0.0f }) - vxx(state->bmp.trees[it->bmp_index].dims * vf2 { 0.0f, -0.175f }));
+				ChunkSummary summary;
+				summarize_cold_chunk(&summary, &slot->value->packed);
+				draw_summary(origin_of(slot->value->packed.coords), &summary);
 			}
 		}
 	}
+	else
+	{
+		FOR_ELEMS(it, trans->cached_ground_bmps, CACHED_GROUND_BMP_CAPACITY)
+		{
+			if (it->exists)
+			{
+				draw_bmp(screen, { CACHED_GROUND_BMP_DIMS, it->rgba }, screen_coords_of(it->coords, { 0.0f, 0.0f, 0.0f }));
+			}
+		}
 
-	//
-	// Render pressure plate.
-	//
+		//
+		// Render trees.
+		//
 
-	draw_rect_outline(screen, screen_coords_of(state->pressure_plate.coords, { 0.0f, 0.0f, 0.0f }), vxx(vf2 { 1.0f, 1.0f } * PIXELS_PER_METER), rgba_from(0.25f, 0.25f, 0.25f));
-	draw_bmp(screen, state->bmp.pressure_plate, screen_coords_of(state->pressure_plate.coords, { 0.0f, 0.0f, 0.0f }), state->pressure_plate.pressed ? 1.0f : 0.5f);
+		// @TODO@ Render what's visible.
+		FOR_RANGE(chunk_iy, -4, 4)
+		{
+			FOR_RANGE(chunk_ix, -4, 4)
+			{
+				// @NOTE@ Cold chunks are drawn straight from their packed trees; rendering never thaws them.
+				vi2        chunk_coords = vi2 { chunk_ix, chunk_iy } * CHUNK_DIM;
+				Chunk*     chunk        = find_chunk(state, chunk_coords);
+				ColdChunk* cold_chunk   = chunk ? 0 : find(&state->cold_chunks.chunks, chunk_coords);
+				Tree       cold_trees[COLD_CHUNK_TREE_MAX];
+				Tree*      trees        = 0;
+				i32        tree_count   = 0;
+				if (chunk)
+				{
+					trees      = chunk->trees;
+					tree_count = chunk->tree_count;
+				}
+				else if (cold_chunk)
+				{
+					unpack_trees(cold_trees, &cold_chunk->packed);
+					trees      = cold_trees;
+					tree_count = cold_chunk->packed.tree_count;
+				}
 
-	//
-	// Render hero.
-	//
+				FOR_ELEMS(it, trees, tree_count)
+				{
+					draw_rect_outline(screen, screen_coords_of(it->coords, { 0.0f, 0.0f, 0.0f }), vxx(vf2 { 1.0f, 1.0f } * PIXELS_PER_METER), rgba_from(0.1f, 0.3f, 0.1f));
+					draw_bmp(screen, state->bmp.trees[it->bmp_index], screen_coords_of(it->coords, { 0.0f, 0.0f, 0.0f }) - vxx(state->bmp.trees[it->bmp_index].dims * vf2 { 0.0f, -0.175f }));
+				}
+			}
+		}
 
-	draw_rect_outline(screen, screen_coords_of(state->hero.coords, { 0.0f, 0.0f, 0.0f }), vxx(vf2 { 1.0f, 1.0f } * PIXELS_PER_METER), rgba_from(0.1f, 0.2f, 0.3f));
-	draw_bmp(screen, state->bmp.hero_shadow                      , screen_coords_of(state->hero.coords, vxn(state->hero.rel_pos.xy, 0.0f)) - vxx(state->bmp.hero_shadow                      .dims * vf2 { 0.0f, -0.3f }));
-	draw_bmp(screen, state->bmp.hero_torsos[state->hero.cardinal], screen_coords_of(state->hero.coords,     state->hero.rel_pos          ) - vxx(state->bmp.hero_torsos[state->hero.cardinal].dims * vf2 { 0.0f, -0.3f }));
-	draw_bmp(screen, state->bmp.hero_capes [state->hero.cardinal], screen_coords_of(state->hero.coords,     state->hero.rel_pos          ) - vxx(state->bmp.hero_capes [state->hero.cardinal].dims * vf2 { 0.0f, -0.3f }));
-	draw_bmp(screen, state->bmp.hero_heads [state->hero.cardinal], screen_coords_of(state->hero.coords,     state->hero.rel_pos          ) - vxx(state->bmp.hero_heads [state->hero.cardinal].dims * vf2 { 0.0f, -0.3f }));
-	draw_hp(state->hero.coords, state->hero.hp);
+		//
+		// Render pressure plate.
+		//
 
-	//
-	// Render pet.
-	//
+		draw_rect_outline(screen, screen_coords_of(state->pressure_plate.coords, { 0.0f, 0.0f, 0.0f }), vxx(vf2 { 1.0f, 1.0f } * PIXELS_PER_METER), rgba_from(0.25f, 0.25f, 0.25f));
+		draw_bmp(screen, state->bmp.pressure_plate, screen_coords_of(state->pressure_plate.coords, { 0.0f, 0.0f, 0.0f }), state->pressure_plate.pressed ? 1.0f : 0.5f);
+
+		//
+		// Render hero.
+		//
+
+		{
+			vf3 rel_pos = blend(state->hero.prev_rel_pos, state->hero.rel_pos);
+			draw_rect_outline(screen, screen_coords_of(state->hero.coords, { 0.0f, 0.0f, 0.0f }), vxx(vf2 { 1.0f, 1.0f } * PIXELS_PER_METER), rgba_from(0.1f, 0.2f, 0.3f));
+			draw_bmp(screen, state->bmp.hero_shadow                      , screen_coords_of(state->hero.coords, vxn(rel_pos.xy, 0.0f)) - vxx(state->bmp.hero_shadow                      .dims * vf2 { 0.0f, -0.3f }));
+			draw_bmp(screen, state->bmp.hero_torsos[state->hero.cardinal], screen_coords_of(state->hero.coords,     rel_pos          ) - vxx(state->bmp.hero_torsos[state->hero.cardinal].dims * vf2 { 0.0f, -0.3f }));
+			draw_bmp(screen, state->bmp.hero_capes [state->hero.cardinal], screen_coords_of(state->hero.coords,     rel_pos          ) - vxx(state->bmp.hero_capes [state->hero.cardinal].dims * vf2 { 0.0f, -0.3f }));
+			draw_bmp(screen, state->bmp.hero_heads [state->hero.cardinal], screen_coords_of(state->hero.coords,     rel_pos          ) - vxx(state->bmp.hero_heads [state->hero.cardinal].dims * vf2 { 0.0f, -0.3f }));
+			draw_hp(state->hero.coords, state->hero.hp);
+		}
+
+		//
+		// Render pet.
+		//
+
+		{
+			vf3 rel_pos = blend(state->pet.prev_rel_pos, state->pet.rel_pos);
+			draw_rect_outline(screen, screen_coords_of(state->pet.coords, { 0.0f, 0.0f, 0.0f }), vxx(vf2 { 1.0f, 1.0f } * PIXELS_PER_METER), rgba_from(0.1f, 0.3f, 0.3f));
+			draw_bmp(screen, state->bmp.hero_shadow                     , screen_coords_of(state->pet.coords, vxn(rel_pos.xy, 0.0f)) - vxx(state->bmp.hero_shadow                     .dims * vf2 { 0.0f, -0.300f }));
+			draw_bmp(screen, state->bmp.hero_heads [state->pet.cardinal], screen_coords_of(state->pet.coords,     rel_pos          ) - vxx(state->bmp.hero_heads [state->pet.cardinal].dims * vf2 { 0.0f,  0.025f}));
+		}
+
+		//
+		// Render monstars.
+		//
 
-	draw_rect_outline(screen, screen_coords_of(state->pet.coords, { 0.0f, 0.0f, 0.0f }), vxx(vf2 { 1.0f, 1.0f } * PIXELS_PER_METER), rgba_from(0.1f, 0.3f, 0.3f));
-	draw_bmp(screen, state->bmp.hero_shadow                     , screen_coords_of(state->pet.coords, vxn(state->pet.rel_pos.xy, 0.0f)) - vxx(state->bmp.hero_shadow                     .dims * vf2 { 0.0f, -0.300f }));
-	draw_bmp(screen, state->bmp.hero_heads [state->pet.cardinal], screen_coords_of(state->pet.coords,     state->pet.rel_pos          ) - vxx(state->bmp.hero_heads [state->pet.cardinal].dims * vf2 { 0.0f,  0.025f}));
+		FOR_ELEMS(it, state->monstars.elems, state->monstars.count)
+		{
+			vf3 rel_pos = blend(prev_rel_pos_of(&state->monstars.hot, it_index), rel_pos_of(&state->monstars.hot, it_index));
+			draw_rect_outline(screen, screen_coords_of(it->coords, { 0.0f, 0.0f, 0.0f }), vxx(vf2 { 1.0f, 1.0f } * PIXELS_PER_METER), rgba_from(0.3f, 0.1f, 0.1f));
+			draw_bmp(screen, state->bmp.hero_shadow              , screen_coords_of(it->coords, vxn(rel_pos.xy, 0.0f)) - vxx(state->bmp.hero_shadow               .dims * vf2 { 0.0f, -0.3f }));
+			draw_bmp(screen, state->bmp.hero_torsos[it->cardinal], screen_coords_of(it->coords,     rel_pos          ) - vxx(state->bmp.hero_torsos [it->cardinal].dims * vf2 { 0.0f, -0.3f }));
+			if (+(it->flag & MonstarFlag::attractive))
+			{
+				draw_bmp(screen, state->bmp.hero_capes[it->cardinal], screen_coords_of(it->coords, rel_pos) - vxx(state->bmp.hero_capes [it->cardinal].dims * vf2 { 0.0f, -0.3f }));
+			}
+			draw_hp(it->coords, it->hp);
+		}
+	}
 
 	//
-	// Render monstar.
+	// Render overdraw heat-map.
 	//
 
-	if (state->monstar.existence_t != 0.0f)
+	if (trans->overdraw_mode)
 	{
-		draw_rect_outline(screen, screen_coords_of(state->monstar.coords, { 0.0f, 0.0f, 0.0f }), vxx(vf2 { 1.0f, 1.0f } * PIXELS_PER_METER), rgba_from(0.3f, 0.1f, 0.1f));
-		draw_bmp(screen, state->bmp.hero_shadow                         , screen_coords_of(state->monstar.coords, vxn(state->monstar.rel_pos.xy, 0.0f)) - vxx(state->bmp.hero_shadow                          .dims * vf2 { 0.0f, -0.3f }));
-		draw_bmp(screen, state->bmp.hero_torsos[state->monstar.cardinal], screen_coords_of(state->monstar.coords,     state->monstar.rel_pos          ) - vxx(state->bmp.hero_torsos [state->monstar.cardinal].dims * vf2 { 0.0f, -0.3f }));
-		if (+(state->monstar.flag & MonstarFlag::attractive))
+		g_overdraw_map = 0;
+
+		constexpr u32 HEAT_RAMP[] =
+			{
+				0x00000000, // Never written.
+				0x00102080, // Written once.
+				0x001080C0,
+				0x0020C040,
+				0x00E0E020,
+				0x00F08010,
+				0x00E02010,
+				0x00FFFFFF  // Written `capacityof(HEAT_RAMP) - 1` times or more.
+			};
+
+		i64 write_count = 0;
+		FOR_RANGE(i, screen.dims.x * screen.dims.y)
+		{
+			u16 count    = trans->overdraw_map.counts[i];
+			write_count += count;
+			screen.rgba[i] = HEAT_RAMP[min(static_cast<i64>(count), capacityof(HEAT_RAMP) - 1)];
+		}
+		trans->overdraw_ratio = static_cast<f32>(write_count) / static_cast<f32>(screen.dims.x * screen.dims.y);
+
+		// @NOTE@ Ratio bar along the top; each tick marks one full-screen's worth of writes.
+		constexpr i32 RATIO_BAR_HEIGHT    = 8;
+		constexpr f32 RATIO_BAR_MAX_RATIO = 16.0f;
+		i32 ratio_bar_width = static_cast<i32>(min(trans->overdraw_ratio / RATIO_BAR_MAX_RATIO, 1.0f) * static_cast<f32>(screen.dims.x));
+		draw_rect(screen, { ratio_bar_width / 2, screen.dims.y - RATIO_BAR_HEIGHT / 2 }, { ratio_bar_width, RATIO_BAR_HEIGHT }, rgba_from(1.0f, 1.0f, 1.0f));
+		FOR_RANGE(i, 1, static_cast<i32>(RATIO_BAR_MAX_RATIO))
 		{
-			draw_bmp(screen, state->bmp.hero_capes[state->monstar.cardinal], screen_coords_of(state->monstar.coords, state->monstar.rel_pos) - vxx(state->bmp.hero_capes [state->monstar.cardinal].dims * vf2 { 0.0f, -0.3f }));
+			draw_rect(screen, { static_cast<i32>(static_cast<f32>(i) / RATIO_BAR_MAX_RATIO * static_cast<f32>(screen.dims.x)), screen.dims.y - RATIO_BAR_HEIGHT / 2 }, { 2, RATIO_BAR_HEIGHT }, rgba_from(0.5f, 0.5f, 0.5f));
 		}
-		draw_hp(state->monstar.coords, state->monstar.hp);
 	}
+}
 
-	return PlatformUpdateExitCode::normal;
+PlatformSettle_t(PlatformSettle)
+{
+	State* state = reinterpret_cast<State*>(platform_memory);
+	if (state->inited)
+	{
+		// @NOTE@ Streaming jobs hold file data and file procedures of the host's, which would be stale in a copy.
+		finish_streaming_jobs(state, PlatformFreeFileData, true);
+	}
 }
 
 PlatformSound_t(PlatformSound)
@@ -0,0 +1,787 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include <time.h>
+#include <pthread.h>
+#include <semaphore.h>
+#include <sched.h>
+#include <unistd.h>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include "unified.h"
+#include "platform.h"
+#include "framebuffer.cpp"
+#include "HandmadeRalph.cpp"
+
+// @NOTE@ Windowless host that runs the game with scripted input and dumps framebuffers; the game is compiled into this translation unit directly.
+
+constexpr i32 UPDATES_PER_SECOND        = 24;
+constexpr f32 SECONDS_PER_UPDATE        = 1.0f / UPDATES_PER_SECOND;
+constexpr vi2 FRAMEBUFFER_DIMS          = { 1080, 720 };
+constexpr i32 PRESENT_RING_MAX_CAPACITY = 8;
+
+struct PresentSlot
+{
+	PlatformFramebuffer host_framebuffer;
+	PlatformFramebuffer game_framebuffer;
+	i32                 frame_index;
+};
+
+// @NOTE@ The main thread renders into free slots while the present thread converts and dumps ready slots in order.
+struct PresentRing
+{
+	sem_t        free_semaphore;
+	sem_t        ready_semaphore;
+	i32          capacity;
+	i32          render_index;  // @NOTE@ Only touched by the main thread.
+	i32          present_index; // @NOTE@ Only touched by the present thread.
+	bool32       stopping;
+	String       dump_frames_prefix;
+	bool32       dump_frames_failed;
+	PresentSlot* last_presented_slot;
+	PresentSlot  slots[PRESENT_RING_MAX_CAPACITY];
+};
+
+constexpr i32 WORK_QUEUE_CAPACITY = 256;
+constexpr i32 WORKER_THREAD_MAX   = 16;
+
+struct WorkQueueEntry
+{
+	PlatformWork_t* work;
+	void*           data;
+};
+
+// @NOTE@ Only the main thread pushes; worker threads, and the main thread while it waits on the queue, claim entries by bumping `read_index`.
+struct WorkQueue
+{
+	sem_t          semaphore;
+	i32            write_index;
+	i32            read_index;
+	i32            pushed_count; // @NOTE@ Only touched by the main thread.
+	i32            completed_count;
+	bool32         stopping;
+	WorkQueueEntry entries[WORK_QUEUE_CAPACITY];
+};
+
+#pragma pack(push, 1)
+struct BitmapInfoHeader
+{
+	char name[2];
+	u32  file_size;
+	u16  reserved[2];
+	u32  pixel_data_offset;
+	u32  dib_header_size;
+	vi2  dims;
+	u16  color_planes;
+	u16  bits_per_pixel;
+	u32  compression_method;
+	u32  pixel_data_size;
+	vi2  pixels_per_meter;
+	u32  color_count;
+	u32  important_colors;
+};
+#pragma pack(pop)
+
+global i32         g_unfreed_file_data_counter = 0; // @NOTE@ Files are also read from worker threads.
+global PresentRing g_present_ring              = {};
+global WorkQueue   g_work_queue                = {};
+
+procedure bool32 copy_cstr(char* dst, i64 dst_capacity, String src)
+{
+	if (src.size >= dst_capacity)
+	{
+		return false;
+	}
+	memcpy(dst, src.data, static_cast<size_t>(src.size));
+	dst[src.size] = '\0';
+	return true;
+}
+
+procedure PlatformReadFileData_t(PlatformReadFileData)
+{
+	char file_path[256];
+	if (!copy_cstr(file_path, capacityof(file_path), platform_file_path))
+	{
+		printf(__FILE__ " :: %s :: File path `%.*s` is too long.\n", __func__, PASS_ISTR(platform_file_path));
+		return {};
+	}
+
+	FILE* file = fopen(file_path, "rb");
+	if (!file)
+	{
+		printf(__FILE__ " :: %s :: Failed to open file `%s` for reading.\n", __func__, file_path);
+		return {};
+	}
+	DEFER { fclose(file); };
+
+	if (fseek(file, 0, SEEK_END))
+	{
+		printf(__FILE__ " :: %s :: Failed to get size of `%s`.\n", __func__, file_path);
+		return {};
+	}
+	long file_size = ftell(file);
+	if (file_size < 0 || fseek(file, 0, SEEK_SET))
+	{
+		printf(__FILE__ " :: %s :: Failed to get size of `%s`.\n", __func__, file_path);
+		return {};
+	}
+
+	PlatformFileData platform_file_data =
+		{
+			.size = static_cast<u64>(file_size),
+			.data = reinterpret_cast<byte*>(malloc(static_cast<size_t>(max(file_size, 1L))))
+		};
+
+	if (!platform_file_data.data)
+	{
+		printf(__FILE__ " :: %s :: Failed to allocate `%zu` bytes for `%s`.\n", __func__, platform_file_data.size, file_path);
+		return {};
+	}
+
+	if (fread(platform_file_data.data, 1, platform_file_data.size, file) != platform_file_data.size)
+	{
+		printf(__FILE__ " :: %s :: Incomplete read of `%s`.\n", __func__, file_path);
+		free(platform_file_data.data);
+		return {};
+	}
+
+	__atomic_add_fetch(&g_unfreed_file_data_counter, 1, __ATOMIC_RELAXED);
+	return platform_file_data;
+}
+
+procedure PlatformFreeFileData_t(PlatformFreeFileData)
+{
+	ASSERT(platform_file_data->data);
+	free(platform_file_data->data);
+	__atomic_sub_fetch(&g_unfreed_file_data_counter, 1, __ATOMIC_RELAXED);
+}
+
+procedure PlatformWriteFile_t(PlatformWriteFile)
+{
+	char file_path[256];
+	if (!copy_cstr(file_path, capacityof(file_path), platform_file_path))
+	{
+		printf(__FILE__ " :: %s :: File path `%.*s` is too long.\n", __func__, PASS_ISTR(platform_file_path));
+		return false;
+	}
+
+	FILE* file = fopen(file_path, "wb");
+	if (!file)
+	{
+		printf(__FILE__ " :: %s :: Failed to open file `%s` for writing.\n", __func__, file_path);
+		return false;
+	}
+	DEFER { fclose(file); };
+
+	if (fwrite(platform_write_data, 1, platform_write_size, file) != platform_write_size)
+	{
+		printf(__FILE__ " :: %s :: Incomplete write of `%zu` bytes to `%s`.\n", __func__, platform_write_size, file_path);
+		return false;
+	}
+
+	return true;
+}
+
+procedure PlatformMapFileData_t(PlatformMapFileData)
+{
+	char file_path[256];
+	if (!copy_cstr(file_path, capacityof(file_path), platform_file_path))
+	{
+		printf(__FILE__ " :: %s :: File path `%.*s` is too long.\n", __func__, PASS_ISTR(platform_file_path));
+		return {};
+	}
+
+	int file = open(file_path, O_RDONLY);
+	if (file < 0)
+	{
+		printf(__FILE__ " :: %s :: Failed to open file `%s` for reading.\n", __func__, file_path);
+		return {};
+	}
+	DEFER { close(file); }; // @NOTE@ The mapping stays valid once the file's closed.
+
+	struct stat file_stat;
+	if (fstat(file, &file_stat))
+	{
+		printf(__FILE__ " :: %s :: Failed to get size of `%s`.\n", __func__, file_path);
+		return {};
+	}
+
+	if (!file_stat.st_size)
+	{
+		printf(__FILE__ " :: %s :: File `%s` is empty, so there's nothing to map.\n", __func__, file_path);
+		return {};
+	}
+
+	void* data = mmap(0, static_cast<size_t>(file_stat.st_size), PROT_READ, MAP_PRIVATE, file, 0);
+	if (data == MAP_FAILED)
+	{
+		printf(__FILE__ " :: %s :: Failed to map `%s`.\n", __func__, file_path);
+		return {};
+	}
+
+	__atomic_add_fetch(&g_unfreed_file_data_counter, 1, __ATOMIC_RELAXED);
+	return { .size = static_cast<u64>(file_stat.st_size), .data = reinterpret_cast<byte*>(data) };
+}
+
+procedure PlatformUnmapFileData_t(PlatformUnmapFileData)
+{
+	ASSERT(platform_file_data->data);
+	munmap(platform_file_data->data, static_cast<size_t>(platform_file_data->size));
+	__atomic_sub_fetch(&g_unfreed_file_data_counter, 1, __ATOMIC_RELAXED);
+}
+
+procedure PlatformPushWork_t(PlatformPushWork)
+{
+	i32 next_write_index = (g_work_queue.write_index + 1) % WORK_QUEUE_CAPACITY;
+	if (next_write_index == __atomic_load_n(&g_work_queue.read_index, __ATOMIC_ACQUIRE))
+	{
+		return false;
+	}
+
+	g_work_queue.entries[g_work_queue.write_index] = { platform_work, platform_work_data };
+	g_work_queue.pushed_count                    += 1;
+	__atomic_store_n(&g_work_queue.write_index, next_write_index, __ATOMIC_RELEASE);
+	sem_post(&g_work_queue.semaphore);
+	return true;
+}
+
+// @NOTE@ False if there was nothing left to claim.
+procedure bool32 do_next_work(void)
+{
+	i32 read_index = __atomic_load_n(&g_work_queue.read_index, __ATOMIC_ACQUIRE);
+	if (read_index == __atomic_load_n(&g_work_queue.write_index, __ATOMIC_ACQUIRE))
+	{
+		return false;
+	}
+
+	// @NOTE@ Copied before claiming, since the main thread may refill the entry as soon as `read_index` moves past it.
+	WorkQueueEntry entry = g_work_queue.entries[read_index];
+	if (__atomic_compare_exchange_n(&g_work_queue.read_index, &read_index, (read_index + 1) % WORK_QUEUE_CAPACITY, false, __ATOMIC_ACQ_REL, __ATOMIC_ACQUIRE))
+	{
+		entry.work(entry.data);
+		__atomic_add_fetch(&g_work_queue.completed_count, 1, __ATOMIC_RELEASE);
+	}
+	return true;
+}
+
+procedure void complete_all_work(void)
+{
+	while (__atomic_load_n(&g_work_queue.completed_count, __ATOMIC_ACQUIRE) != g_work_queue.pushed_count)
+	{
+		if (!do_next_work())
+		{
+			sched_yield();
+		}
+	}
+}
+
+procedure void* worker_thread_procedure(void*)
+{
+	while (true)
+	{
+		if (!do_next_work())
+		{
+			sem_wait(&g_work_queue.semaphore);
+			if (__atomic_load_n(&g_work_queue.stopping, __ATOMIC_ACQUIRE))
+			{
+				return 0;
+			}
+		}
+	}
+}
+
+procedure bool32 write_framebuffer_bmp(String file_path, PlatformFramebuffer* framebuffer)
+{
+	u32   pixel_data_size = static_cast<u32>(framebuffer->dims.x * framebuffer->dims.y) * sizeof(u32);
+	u64   file_size       = sizeof(BitmapInfoHeader) + pixel_data_size;
+	byte* file_data       = reinterpret_cast<byte*>(malloc(file_size));
+	if (!file_data)
+	{
+		return false;
+	}
+	DEFER { free(file_data); };
+
+	BitmapInfoHeader header =
+		{
+			.name               = { 'B', 'M' },
+			.file_size          = static_cast<u32>(file_size),
+			.pixel_data_offset  = sizeof(BitmapInfoHeader),
+			.dib_header_size    = sizeof(BitmapInfoHeader) - offsetof(BitmapInfoHeader, dib_header_size),
+			.dims               = { framebuffer->dims.x, -framebuffer->dims.y }, // @NOTE@ Top-down.
+			.color_planes       = 1,
+			.bits_per_pixel     = 32,
+			.compression_method = 0,
+			.pixel_data_size    = pixel_data_size
+		};
+	memcpy(file_data, &header, sizeof(BitmapInfoHeader));
+
+	PlatformFramebuffer bitmap_framebuffer =
+		{
+			.dims   = framebuffer->dims,
+			.stride = framebuffer->dims.x,
+			.format = PlatformPixelFormat::bgra,
+			.pixels = reinterpret_cast<u32*>(file_data + sizeof(BitmapInfoHeader))
+		};
+	blit_framebuffer(&bitmap_framebuffer, framebuffer);
+
+	return PlatformWriteFile(file_path, file_data, file_size);
+}
+
+// @NOTE@ Copies everything live in the game's memory over to `dst` and scribbles over the original, so anything in it that points into itself shows up.
+// The arenas hand out memory from the top down, so what's live is `State`, `TransState`, and the tail of each arena.
+procedure void relocate_platform_memory(byte* dst, byte* src)
+{
+	State*      state = reinterpret_cast<State     *>(src                );
+	TransState* trans = reinterpret_cast<TransState*>(src + sizeof(State));
+
+	lambda move =
+		[&](i64 offset, i64 size)
+		{
+			memcpy(dst + offset, src + offset, static_cast<size_t>(size));
+			memset(src + offset, 0xCD, static_cast<size_t>(size));
+		};
+
+	MemoryArena* arenas[] = { &state->arena, &trans->arena };
+	FOR_ELEMS(it, arenas)
+	{
+		if ((*it)->data)
+		{
+			move(static_cast<byte*>((*it)->data) - src + (*it)->size - (*it)->used, (*it)->used);
+		}
+	}
+	move(0, sizeof(State) + sizeof(TransState));
+}
+
+procedure f64 query_seconds(void)
+{
+	timespec time;
+	clock_gettime(CLOCK_MONOTONIC, &time);
+	return static_cast<f64>(time.tv_sec) + static_cast<f64>(time.tv_nsec) / 1000000000.0;
+}
+
+procedure void* present_thread_procedure(void*)
+{
+	while (true)
+	{
+		sem_wait(&g_present_ring.ready_semaphore);
+		if (g_present_ring.stopping)
+		{
+			return 0;
+		}
+
+		PresentSlot* slot = &g_present_ring.slots[g_present_ring.present_index];
+		if (slot->game_framebuffer.pixels != slot->host_framebuffer.pixels)
+		{
+			blit_framebuffer(&slot->host_framebuffer, &slot->game_framebuffer);
+		}
+
+		if (+g_present_ring.dump_frames_prefix)
+		{
+			char file_path[256];
+			i32  file_path_size = snprintf(file_path, sizeof(file_path), "%.*s%04d.bmp", PASS_ISTR(g_present_ring.dump_frames_prefix), slot->frame_index);
+			if (!IN_RANGE(file_path_size, 0, static_cast<i32>(sizeof(file_path))) || !write_framebuffer_bmp({ file_path_size, file_path }, &slot->host_framebuffer))
+			{
+				g_present_ring.dump_frames_failed = true;
+			}
+		}
+
+		g_present_ring.last_presented_slot = slot;
+		g_present_ring.present_index       = (g_present_ring.present_index + 1) % g_present_ring.capacity;
+		sem_post(&g_present_ring.free_semaphore);
+	}
+}
+
+#include "golden.cpp"
+#include "bench.cpp"
+
+int main(int argc, char** argv)
+{
+	i32                 frame_count    = 24;
+	i32                 render_rate    = 24;
+	bool32              world_map      = false;
+	bool32              overdraw       = false;
+	String              dump_file_path = {};
+	PlatformPixelFormat host_format    = PlatformPixelFormat::bgra;
+	i32                 host_padding   = 0;
+	i32                 ring_capacity  = 3;
+	String              frames_prefix  = {};
+	String              golden_dir     = {};
+	bool32              update_golden  = false;
+	i32                 tolerance      = 0;
+	const Bench*        bench          = 0;
+	bool32              relocate       = false;
+
+	FOR_RANGE(i, 1, argc)
+	{
+		String arg = { static_cast<i64>(strlen(argv[i])), argv[i] };
+		if (arg == String("--frames") && i + 1 < argc)
+		{
+			i          += 1;
+			frame_count = max(atoi(argv[i]), 1);
+		}
+		else if (arg == String("--render-rate") && i + 1 < argc)
+		{
+			i          += 1;
+			render_rate = clamp(atoi(argv[i]), 1, 1000);
+		}
+		else if (arg == String("--world-map"))
+		{
+			world_map = true;
+		}
+		else if (arg == String("--overdraw"))
+		{
+			overdraw = true;
+		}
+		else if (arg == String("--dump") && i + 1 < argc)
+		{
+			i             += 1;
+			dump_file_path = { static_cast<i64>(strlen(argv[i])), argv[i] };
+		}
+		else if (arg == String("--host-rgba"))
+		{
+			host_format = PlatformPixelFormat::rgba;
+		}
+		else if (arg == String("--host-padding") && i + 1 < argc)
+		{
+			i           += 1;
+			host_padding = max(atoi(argv[i]), 0);
+		}
+		else if (arg == String("--ring") && i + 1 < argc)
+		{
+			i            += 1;
+			ring_capacity = clamp(atoi(argv[i]), 1, PRESENT_RING_MAX_CAPACITY);
+		}
+		else if (arg == String("--dump-frames") && i + 1 < argc)
+		{
+			i            += 1;
+			frames_prefix = { static_cast<i64>(strlen(argv[i])), argv[i] };
+		}
+		else if (arg == String("--golden") && i + 1 < argc)
+		{
+			i         += 1;
+			golden_dir = { static_cast<i64>(strlen(argv[i])), argv[i] };
+		}
+		else if (arg == String("--update-golden"))
+		{
+			update_golden = true;
+		}
+		else if (find_bench(arg))
+		{
+			bench = find_bench(arg);
+		}
+		else if (arg == String("--relocate"))
+		{
+			relocate = true;
+		}
+		else if (arg == String("--tolerance") && i + 1 < argc)
+		{
+			i        += 1;
+			tolerance = clamp(atoi(argv[i]), 0, 255);
+		}
+		else
+		{
+			printf("Usage: %s [--frames N] [--render-rate N] [--world-map] [--overdraw] [--dump FILE.bmp] [--host-rgba] [--host-padding N] [--ring N] [--dump-frames PREFIX] [--golden DIR [--update-golden] [--tolerance N]] [--relocate]", argv[0]);
+			FOR_ELEMS(it, BENCHES)
+			{
+				printf(" [%.*s]", PASS_ISTR(it->flag));
+			}
+			printf
+			(
+				"\n"
+				"\t--frames        : Amount of frames to render with no input, at least one (default 24).\n"
+				"\t--render-rate   : Frames rendered per second of game time, which is always updated at 24 Hz; in between, frames are interpolated (default 24).\n"
+				"\t--world-map     : Render the world map from the chunk summaries instead of the scene.\n"
+				"\t--overdraw      : Render the overdraw heat-map instead of the scene.\n"
+				"\t--dump          : Write the final framebuffer out as a bitmap.\n"
+				"\t--host-rgba     : Pretend the host's native framebuffer is RGBA so presenting needs a conversion.\n"
+				"\t--host-padding  : Pad each row of the host's native framebuffer by N pixels.\n"
+				"\t--ring          : Amount of framebuffers the game can render into ahead of presentation (default 3; 1 is fully serial).\n"
+				"\t--dump-frames   : Write every presented frame out as `PREFIX0000.bmp`, `PREFIX0001.bmp`, etc.\n"
+				"\t--golden        : Run every golden scene and compare its final frame against `DIR/<scene>.bmp`, writing `DIR/<scene>.diff.bmp` on mismatch.\n"
+				"\t--update-golden : Write the golden scenes' final frames to `DIR/<scene>.bmp` instead of comparing.\n"
+				"\t--tolerance     : Largest per-channel difference from a golden frame that still matches (default 0).\n"
+				"\t--relocate      : Move the game's memory to a different address before every frame.\n"
+			);
+			FOR_ELEMS(it, BENCHES)
+			{
+				printf("\t%.*s : %s\n", PASS_ISTR(it->flag), it->description);
+			}
+			return 1;
+		}
+	}
+
+	//
+	// Initialize work queue.
+	//
+
+	if (sem_init(&g_work_queue.semaphore, 0, 0))
+	{
+		printf(__FILE__ " :: Failed to create work queue semaphore.\n");
+		return 1;
+	}
+
+	pthread_t worker_threads[WORKER_THREAD_MAX];
+	i32       worker_thread_count = clamp(static_cast<i32>(sysconf(_SC_NPROCESSORS_ONLN)) - 1, 1, WORKER_THREAD_MAX);
+	FOR_ELEMS(it, worker_threads, worker_thread_count)
+	{
+		if (pthread_create(it, 0, worker_thread_procedure, 0))
+		{
+			printf(__FILE__ " :: Failed to create worker thread.\n");
+			return 1;
+		}
+	}
+	DEFER
+	{
+		complete_all_work();
+		__atomic_store_n(&g_work_queue.stopping, true, __ATOMIC_RELEASE);
+		FOR_ELEMS(it, worker_threads, worker_thread_count)
+		{
+			sem_post(&g_work_queue.semaphore);
+		}
+		FOR_ELEMS(it, worker_threads, worker_thread_count)
+		{
+			pthread_join(*it, 0);
+		}
+	};
+
+	if (bench)
+	{
+		return run_bench(bench) ? 0 : 1;
+	}
+
+	byte* platform_memory       = reinterpret_cast<byte*>(calloc(PLATFORM_MEMORY_SIZE, 1));
+	byte* spare_platform_memory = relocate ? reinterpret_cast<byte*>(calloc(PLATFORM_MEMORY_SIZE, 1)) : 0;
+	DEFER { free(platform_memory); free(spare_platform_memory); };
+	if (!platform_memory || (relocate && !spare_platform_memory))
+	{
+		printf(__FILE__ " :: Failed to allocate memory.\n");
+		return 1;
+	}
+
+	//
+	// Initialize present ring.
+	//
+
+	g_present_ring.capacity           = ring_capacity;
+	g_present_ring.dump_frames_prefix = frames_prefix;
+
+	FOR_ELEMS(slot, g_present_ring.slots, g_present_ring.capacity)
+	{
+		slot->host_framebuffer =
+			{
+				.dims   = FRAMEBUFFER_DIMS,
+				.stride = FRAMEBUFFER_DIMS.x + host_padding,
+				.format = host_format,
+				.pixels = reinterpret_cast<u32*>(calloc(static_cast<size_t>((FRAMEBUFFER_DIMS.x + host_padding) * FRAMEBUFFER_DIMS.y), sizeof(u32)))
+			};
+
+		slot->game_framebuffer = slot->host_framebuffer;
+		if (!is_game_renderable(slot->host_framebuffer))
+		{
+			slot->game_framebuffer.stride = slot->game_framebuffer.dims.x;
+			slot->game_framebuffer.format = PLATFORM_GAME_PIXEL_FORMAT;
+			slot->game_framebuffer.pixels = reinterpret_cast<u32*>(calloc(static_cast<size_t>(FRAMEBUFFER_DIMS.x * FRAMEBUFFER_DIMS.y), sizeof(u32)));
+		}
+
+		if (!slot->host_framebuffer.pixels || !slot->game_framebuffer.pixels)
+		{
+			printf(__FILE__ " :: Failed to allocate framebuffers.\n");
+			return 1;
+		}
+	}
+	DEFER
+	{
+		FOR_ELEMS(slot, g_present_ring.slots, g_present_ring.capacity)
+		{
+			if (slot->game_framebuffer.pixels != slot->host_framebuffer.pixels)
+			{
+				free(slot->game_framebuffer.pixels);
+			}
+			free(slot->host_framebuffer.pixels);
+		}
+	};
+
+	if (sem_init(&g_present_ring.free_semaphore, 0, static_cast<u32>(g_present_ring.capacity)) || sem_init(&g_present_ring.ready_semaphore, 0, 0))
+	{
+		printf(__FILE__ " :: Failed to create present ring semaphores.\n");
+		return 1;
+	}
+
+	pthread_t present_thread;
+	if (pthread_create(&present_thread, 0, present_thread_procedure, 0))
+	{
+		printf(__FILE__ " :: Failed to create present thread.\n");
+		return 1;
+	}
+
+	lambda drain_present_ring =
+		[&]()
+		{
+			FOR_RANGE(g_present_ring.capacity)
+			{
+				sem_wait(&g_present_ring.free_semaphore);
+			}
+			FOR_RANGE(g_present_ring.capacity)
+			{
+				sem_post(&g_present_ring.free_semaphore);
+			}
+		};
+	DEFER
+	{
+		drain_present_ring();
+		g_present_ring.stopping = true;
+		sem_post(&g_present_ring.ready_semaphore);
+		pthread_join(present_thread, 0);
+	};
+
+	// @NOTE@ Starts the game from scratch so every run is deterministic; returns once the last frame has been presented.
+	// Clearing `State` and `TransState` is enough for the game to reinitialize everything it allocates from the arenas once it's settled. Nothing an earlier run
+	// left in the host carries over either: the work queue and the present ring are both idle by now, and the ring starts back at its first slot with every framebuffer cleared.
+	// Time is kept in whole `1 / (UPDATES_PER_SECOND * run_render_rate)` seconds so that rendering at the update rate is exactly one update a frame.
+	lambda run =
+		[&](i32 run_frame_count, String script, i32 run_render_rate)
+		{
+			complete_all_work();
+			PlatformSettle(platform_memory, PlatformFreeFileData);
+			ASSERT(g_work_queue.read_index == g_work_queue.write_index);
+			ASSERT(g_present_ring.render_index == g_present_ring.present_index);
+			ASSERT(!g_overdraw_map);
+
+			memset(platform_memory, 0, sizeof(State) + sizeof(TransState));
+
+			g_present_ring.render_index        = 0;
+			g_present_ring.present_index       = 0; // @NOTE@ The present thread's waiting on the next slot to be posted, which is when it'll see this.
+			g_present_ring.last_presented_slot = 0;
+			FOR_ELEMS(slot, g_present_ring.slots, g_present_ring.capacity)
+			{
+				memset(slot->host_framebuffer.pixels, 0, static_cast<size_t>(slot->host_framebuffer.stride * slot->host_framebuffer.dims.y) * sizeof(u32));
+				if (slot->game_framebuffer.pixels != slot->host_framebuffer.pixels)
+				{
+					memset(slot->game_framebuffer.pixels, 0, static_cast<size_t>(slot->game_framebuffer.stride * slot->game_framebuffer.dims.y) * sizeof(u32));
+				}
+			}
+
+			PlatformInput platform_input = {};
+			i64           update_count   = 0;
+			FOR_RANGE(frame_index, run_frame_count)
+			{
+				if (frame_index < script.size && script.data[frame_index] != '.')
+				{
+					ASSERT(IN_RANGE(script.data[frame_index], 'a', 'z'));
+					platform_input.button.letters[script.data[frame_index] - 'a'] = 0b10000001;
+				}
+
+				if (relocate)
+				{
+					// @NOTE@ Jobs still queued would be run against the old copy.
+					complete_all_work();
+					PlatformSettle(platform_memory, PlatformFreeFileData);
+					relocate_platform_memory(spare_platform_memory, platform_memory);
+					byte* relocated_platform_memory = spare_platform_memory;
+					spare_platform_memory           = platform_memory;
+					platform_memory                 = relocated_platform_memory;
+				}
+
+				// @NOTE@ Updates until the game's caught up with when this frame is shown, which may be not at all.
+				i64 frame_time = (frame_index + 1) * UPDATES_PER_SECOND;
+				while (update_count * run_render_rate < frame_time)
+				{
+					if (PlatformSimulate(&platform_input, platform_memory, SECONDS_PER_UPDATE, PlatformReadFileData, PlatformFreeFileData, PlatformWriteFile, PlatformMapFileData, PlatformUnmapFileData, PlatformPushWork) == PlatformUpdateExitCode::abort)
+					{
+						printf(__FILE__ " :: Game exit code `abort` on frame `%d`.\n", frame_index);
+						drain_present_ring();
+						return false;
+					}
+					update_count  += 1;
+					platform_input = {};
+				}
+
+				sem_wait(&g_present_ring.free_semaphore);
+				PresentSlot* present_slot   = &g_present_ring.slots[g_present_ring.render_index];
+				present_slot->frame_index   = frame_index;
+				g_present_ring.render_index = (g_present_ring.render_index + 1) % g_present_ring.capacity;
+
+				PlatformRender(&present_slot->game_framebuffer, platform_memory, static_cast<f32>(frame_time - (update_count - 1) * run_render_rate) / static_cast<f32>(run_render_rate));
+
+				sem_post(&g_present_ring.ready_semaphore);
+			}
+
+			drain_present_ring();
+			return true;
+		};
+
+	//
+	// Run golden scenes.
+	//
+
+	if (+golden_dir)
+	{
+		if (!run_golden_scenes(run, golden_dir, update_golden, tolerance))
+		{
+			return 1;
+		}
+
+		if (g_unfreed_file_data_counter)
+		{
+			printf(__FILE__ " :: `%d` unfreed file data.\n", g_unfreed_file_data_counter);
+			return 1;
+		}
+
+		return 0;
+	}
+
+	//
+	// Run.
+	//
+
+	char script_buffer[2] = {};
+	i32  script_size      = 0;
+	if (world_map)
+	{
+		script_buffer[script_size] = 'm';
+		script_size               += 1;
+	}
+	if (overdraw)
+	{
+		script_buffer[script_size] = 'o';
+		script_size               += 1;
+	}
+
+	f64 seconds_start = query_seconds();
+
+	if (!run(frame_count, { script_size, script_buffer }, render_rate))
+	{
+		return 1;
+	}
+
+	f64 seconds_elapsed = query_seconds() - seconds_start;
+	printf(":: %d frames with a ring of %d : %.3f ms/frame\n", frame_count, g_present_ring.capacity, seconds_elapsed * 1000.0 / max(frame_count, 1));
+
+	if (g_present_ring.dump_frames_failed)
+	{
+		printf(__FILE__ " :: Failed to dump some frames to `%.*s`.\n", PASS_ISTR(g_present_ring.dump_frames_prefix));
+		return 1;
+	}
+
+	if (overdraw)
+	{
+		TransState* trans = reinterpret_cast<TransState*>(platform_memory + sizeof(State));
+		printf(":: Overdraw ratio : %.3f\n", static_cast<f64>(trans->overdraw_ratio));
+	}
+
+	if (+dump_file_path && (!g_present_ring.last_presented_slot || !write_framebuffer_bmp(dump_file_path, &g_present_ring.last_presented_slot->host_framebuffer)))
+	{
+		printf(__FILE__ " :: Failed to dump framebuffer to `%.*s`.\n", PASS_ISTR(dump_file_path));
+		return 1;
+	}
+
+	if (g_unfreed_file_data_counter)
+	{
+		printf(__FILE__ " :: `%d` unfreed file data.\n", g_unfreed_file_data_counter);
+		return 1;
+	}
+
+	return 0;
+}
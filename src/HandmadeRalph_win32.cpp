@@ -9,6 +9,7 @@
 #include <dxgi.h>
 #include "unified.h"
 #include "platform.h"
+#include "framebuffer.cpp"
 
 #define PROCESS_PLATFORM_BUTTON(BUTTON, IS_DOWN) g_platform_input.button BUTTON = static_cast<u8>(((g_platform_input.button BUTTON + ((g_platform_input.button BUTTON >> 7) != static_cast<bool8>(IS_DOWN))) & 0b01111111) | ((IS_DOWN) << 7))
 
@@ -17,18 +18,73 @@ typedef   XInputGetState_t(XInputGetState_t);
 procedure XInputGetState_t(stub_XInputGetState) { return ERROR_DEVICE_NOT_CONNECTED; }
 global    XInputGetState_t* g_XInputGetState = stub_XInputGetState;
 
+constexpr BITMAPINFO BACKBUFFER_BITMAP_INFO =
+	{
+		.bmiHeader =
+			{
+				.biSize        = sizeof(BACKBUFFER_BITMAP_INFO.bmiHeader),
+				.biWidth       =  1080,
+				.biHeight      = -720,
+				.biPlanes      = 1,
+				.biBitCount    = 32,
+				.biCompression = BI_RGB
+			}
+	};
+
+constexpr i32 PRESENT_RING_CAPACITY = 3;
+
+struct PresentSlot
+{
+	PlatformFramebuffer host_framebuffer;
+	PlatformFramebuffer game_framebuffer;
+};
+
+// @NOTE@ The main thread renders into free slots while the present thread converts and blits ready slots in order.
+struct PresentRing
+{
+	HWND        window;
+	HANDLE      free_semaphore;
+	HANDLE      ready_semaphore;
+	i32         render_index;  // @NOTE@ Only touched by the main thread.
+	i32         present_index; // @NOTE@ Only touched by the present thread.
+	PresentSlot slots[PRESENT_RING_CAPACITY];
+};
+
+constexpr i32 WORK_QUEUE_CAPACITY = 256;
+
+struct WorkQueueEntry
+{
+	PlatformWork_t* work;
+	void*           data;
+};
+
+// @NOTE@ Only the main thread pushes; worker threads, and the main thread while it waits on the queue, claim entries by bumping `read_index`.
+struct WorkQueue
+{
+	HANDLE         semaphore;
+	volatile LONG  write_index;
+	volatile LONG  read_index;
+	LONG           pushed_count; // @NOTE@ Only touched by the main thread.
+	volatile LONG  completed_count;
+	WorkQueueEntry entries[WORK_QUEUE_CAPACITY];
+};
+
 global vi2           g_client_dims                   = { 0, 0 };
 global PlatformInput g_platform_input                = {};
-global i32           g_unfreed_file_data_counter     = 0;
+global volatile LONG g_unfreed_file_data_counter     = 0; // @NOTE@ Files are also read from worker threads.
 global i64           g_performance_counter_frequency = 0;
+global PresentRing   g_present_ring                  = {};
+global WorkQueue     g_work_queue                    = {};
 
 #if DEBUG
 struct Hotloader
 {
-	HMODULE           handle;
-	FILETIME          write_time;
-	PlatformUpdate_t* PlatformUpdate;
-	PlatformSound_t*  PlatformSound;
+	HMODULE             handle;
+	FILETIME            write_time;
+	PlatformSimulate_t* PlatformSimulate;
+	PlatformRender_t*   PlatformRender;
+	PlatformSettle_t*   PlatformSettle;
+	PlatformSound_t*    PlatformSound;
 };
 
 procedure Hotloader DEBUG_hotload()
@@ -50,8 +106,14 @@ procedure Hotloader DEBUG_hotload()
 		}
 	}
 
-	hotloader.PlatformUpdate = reinterpret_cast<PlatformUpdate_t*>(GetProcAddress(hotloader.handle, "PlatformUpdate"));
-	ASSERT(hotloader.PlatformUpdate);
+	hotloader.PlatformSimulate = reinterpret_cast<PlatformSimulate_t*>(GetProcAddress(hotloader.handle, "PlatformSimulate"));
+	ASSERT(hotloader.PlatformSimulate);
+
+	hotloader.PlatformRender = reinterpret_cast<PlatformRender_t*>(GetProcAddress(hotloader.handle, "PlatformRender"));
+	ASSERT(hotloader.PlatformRender);
+
+	hotloader.PlatformSettle = reinterpret_cast<PlatformSettle_t*>(GetProcAddress(hotloader.handle, "PlatformSettle"));
+	ASSERT(hotloader.PlatformSettle);
 
 	hotloader.PlatformSound = reinterpret_cast<PlatformSound_t*>(GetProcAddress(hotloader.handle, "PlatformSound"));
 	ASSERT(hotloader.PlatformSound);
@@ -120,7 +182,7 @@ procedure PlatformReadFileData_t(PlatformReadFileData)
 		return {};
 	}
 
-	g_unfreed_file_data_counter += 1;
+	InterlockedIncrement(&g_unfreed_file_data_counter);
 	return platform_file_data;
 }
 
@@ -128,7 +190,7 @@ procedure PlatformFreeFileData_t(PlatformFreeFileData)
 {
 	ASSERT(platform_file_data->data);
 	VirtualFree(platform_file_data->data, 0, MEM_RELEASE);
-	g_unfreed_file_data_counter -= 1;
+	InterlockedDecrement(&g_unfreed_file_data_counter);
 }
 
 procedure PlatformWriteFile_t(PlatformWriteFile)
@@ -172,6 +234,125 @@ procedure PlatformWriteFile_t(PlatformWriteFile)
 	return true;
 }
 
+procedure PlatformMapFileData_t(PlatformMapFileData)
+{
+	wchar_t wide_file_path[256];
+	u64     wide_file_path_count;
+	if (mbstowcs_s(&wide_file_path_count, wide_file_path, platform_file_path.data, static_cast<size_t>(platform_file_path.size)) || static_cast<i64>(wide_file_path_count) != platform_file_path.size + 1)
+	{
+		DEBUG_printf(__FILE__ " :: %s :: Failed to convert file path `%S` to wide string.\n", __func__, wide_file_path);
+		return {};
+	}
+
+	HANDLE handle = CreateFileW(wide_file_path, GENERIC_READ, FILE_SHARE_READ, 0, OPEN_EXISTING, 0, 0);
+	if (handle == INVALID_HANDLE_VALUE)
+	{
+		DEBUG_printf(__FILE__ " :: %s :: Failed to open file `%S` for reading.\n", __func__, wide_file_path);
+		return {};
+	}
+	DEFER { CloseHandle(handle); };
+
+	LARGE_INTEGER file_size;
+	if (!GetFileSizeEx(handle, &file_size))
+	{
+		DEBUG_printf(__FILE__ " :: %s :: Failed to get size of `%S`.\n", __func__, wide_file_path);
+		return {};
+	}
+
+	if (!file_size.QuadPart)
+	{
+		DEBUG_printf(__FILE__ " :: %s :: File `%S` is empty, so there's nothing to map.\n", __func__, wide_file_path);
+		return {};
+	}
+
+	// @NOTE@ The view keeps the mapping, and the mapping keeps the file, open once their handles are closed.
+	HANDLE mapping = CreateFileMappingW(handle, 0, PAGE_READONLY, 0, 0, 0);
+	if (!mapping)
+	{
+		DEBUG_printf(__FILE__ " :: %s :: Failed to create file mapping of `%S`.\n", __func__, wide_file_path);
+		return {};
+	}
+	DEFER { CloseHandle(mapping); };
+
+	PlatformFileData platform_file_data =
+		{
+			.size = static_cast<u64>(file_size.QuadPart),
+			.data = reinterpret_cast<byte*>(MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0))
+		};
+
+	if (!platform_file_data.data)
+	{
+		DEBUG_printf(__FILE__ " :: %s :: Failed to map view of `%S`.\n", __func__, wide_file_path);
+		return {};
+	}
+
+	InterlockedIncrement(&g_unfreed_file_data_counter);
+	return platform_file_data;
+}
+
+procedure PlatformUnmapFileData_t(PlatformUnmapFileData)
+{
+	ASSERT(platform_file_data->data);
+	UnmapViewOfFile(platform_file_data->data);
+	InterlockedDecrement(&g_unfreed_file_data_counter);
+}
+
+procedure PlatformPushWork_t(PlatformPushWork)
+{
+	LONG next_write_index = (g_work_queue.write_index + 1) % WORK_QUEUE_CAPACITY;
+	if (next_write_index == g_work_queue.read_index)
+	{
+		return false;
+	}
+
+	g_work_queue.entries[g_work_queue.write_index] = { platform_work, platform_work_data };
+	g_work_queue.pushed_count                    += 1;
+	InterlockedExchange(&g_work_queue.write_index, next_write_index); // @NOTE@ Full barrier, so the entry is visible before its index is.
+	ReleaseSemaphore(g_work_queue.semaphore, 1, 0);
+	return true;
+}
+
+// @NOTE@ False if there was nothing left to claim.
+procedure bool32 do_next_work(void)
+{
+	LONG read_index = g_work_queue.read_index;
+	if (read_index == g_work_queue.write_index)
+	{
+		return false;
+	}
+
+	// @NOTE@ Copied before claiming, since the main thread may refill the entry as soon as `read_index` moves past it.
+	WorkQueueEntry entry = g_work_queue.entries[read_index];
+	if (InterlockedCompareExchange(&g_work_queue.read_index, (read_index + 1) % WORK_QUEUE_CAPACITY, read_index) == read_index)
+	{
+		entry.work(entry.data);
+		InterlockedIncrement(&g_work_queue.completed_count);
+	}
+	return true;
+}
+
+procedure void complete_all_work(void)
+{
+	while (g_work_queue.completed_count != g_work_queue.pushed_count)
+	{
+		if (!do_next_work())
+		{
+			YieldProcessor();
+		}
+	}
+}
+
+procedure DWORD WINAPI worker_thread_procedure(LPVOID)
+{
+	while (true)
+	{
+		if (!do_next_work())
+		{
+			WaitForSingleObject(g_work_queue.semaphore, INFINITE);
+		}
+	}
+}
+
 procedure i64 query_performance_counter(void)
 {
 	LARGE_INTEGER n;
@@ -184,6 +365,42 @@ procedure f32 calc_performance_counter_delta_time(i64 start, i64 end)
 	return static_cast<f32>(end - start) / static_cast<f32>(g_performance_counter_frequency);
 }
 
+procedure DWORD WINAPI present_thread_procedure(LPVOID)
+{
+	while (true)
+	{
+		WaitForSingleObject(g_present_ring.ready_semaphore, INFINITE);
+
+		PresentSlot* slot = &g_present_ring.slots[g_present_ring.present_index];
+		if (slot->game_framebuffer.pixels != slot->host_framebuffer.pixels)
+		{
+			blit_framebuffer(&slot->host_framebuffer, &slot->game_framebuffer);
+		}
+
+		HDC device_context = GetDC(g_present_ring.window);
+		StretchDIBits
+		(
+			device_context,
+			0,
+			0,
+			BACKBUFFER_BITMAP_INFO.bmiHeader.biWidth,
+			-BACKBUFFER_BITMAP_INFO.bmiHeader.biHeight,
+			0,
+			0,
+			BACKBUFFER_BITMAP_INFO.bmiHeader.biWidth,
+			-BACKBUFFER_BITMAP_INFO.bmiHeader.biHeight,
+			slot->host_framebuffer.pixels,
+			&BACKBUFFER_BITMAP_INFO,
+			DIB_RGB_COLORS,
+			SRCCOPY
+		);
+		ReleaseDC(g_present_ring.window, device_context);
+
+		g_present_ring.present_index = (g_present_ring.present_index + 1) % PRESENT_RING_CAPACITY;
+		ReleaseSemaphore(g_present_ring.free_semaphore, 1, 0);
+	}
+}
+
 procedure LRESULT window_procedure_callback(HWND window, UINT message, WPARAM wparam, LPARAM lparam)
 {
 	switch (message)
@@ -276,19 +493,7 @@ int WINAPI WinMain(HINSTANCE instance, HINSTANCE, LPSTR, int cmd_show)
 	// Initialize window.
 	//
 
-	constexpr wchar_t    CLASS_NAME[]           = L"HandemadeRalphWindowClass";
-	constexpr BITMAPINFO BACKBUFFER_BITMAP_INFO =
-		{
-			.bmiHeader =
-				{
-					.biSize        = sizeof(BACKBUFFER_BITMAP_INFO.bmiHeader),
-					.biWidth       =  1080,
-					.biHeight      = -720,
-					.biPlanes      = 1,
-					.biBitCount    = 32,
-					.biCompression = BI_RGB
-				}
-		};
+	constexpr wchar_t CLASS_NAME[] = L"HandemadeRalphWindowClass";
 
 	WNDCLASSEXW window_class =
 		{
@@ -480,23 +685,115 @@ int WINAPI WinMain(HINSTANCE instance, HINSTANCE, LPSTR, int cmd_show)
 	// Miscellaneous initializations.
 	//
 
-	constexpr f32 SECONDS_PER_UPDATE              = 1.0f / 24.0f;
-	constexpr i32 MAXIMUM_SAMPLES_PER_UPDATE      = static_cast<i32>(SAMPLES_PER_SECOND * SECONDS_PER_UPDATE + 1);
-	constexpr i32 SAMPLES_OF_LATENCY              = max(MAXIMUM_SAMPLES_PER_UPDATE, SAMPLES_PER_SECOND / 30);
-	constexpr i32 PLATFORM_SAMPLE_BUFFER_CAPACITY = 4 * MAXIMUM_SAMPLES_PER_UPDATE;
+	constexpr f32 SECONDS_PER_UPDATE              = 1.0f / 24.0f; // @NOTE@ Of simulation; rendering goes at whatever rate the display does.
+	constexpr i32 UPDATE_CATCH_UP_MAX             = 8;            // @NOTE@ Past this many updates behind, real time is let go of rather than spiralling.
+	constexpr f32 MAXIMUM_SECONDS_PER_FRAME       = UPDATE_CATCH_UP_MAX * SECONDS_PER_UPDATE; // @NOTE@ Sound is computed at most this far ahead of the next frame; anything longer drops out.
+	constexpr i32 MAXIMUM_SAMPLES_PER_FRAME       = static_cast<i32>(SAMPLES_PER_SECOND * MAXIMUM_SECONDS_PER_FRAME + 1);
+	constexpr i32 SAMPLES_OF_LATENCY              = SAMPLES_PER_SECOND / 30;
+	constexpr i32 PLATFORM_SAMPLE_BUFFER_CAPACITY = MAXIMUM_SAMPLES_PER_FRAME + SAMPLES_OF_LATENCY;
 
-	byte*           backbuffer_bitmap_data = reinterpret_cast<byte*>(VirtualAlloc(0, static_cast<size_t>(4) * BACKBUFFER_BITMAP_INFO.bmiHeader.biWidth * -BACKBUFFER_BITMAP_INFO.bmiHeader.biHeight, MEM_COMMIT, PAGE_READWRITE));
 	PlatformSample* platform_sample_buffer = reinterpret_cast<PlatformSample*>(VirtualAlloc(0, PLATFORM_SAMPLE_BUFFER_CAPACITY * sizeof(PlatformSample), MEM_COMMIT, PAGE_READWRITE));
-	byte*           platform_memory        =
-		#if DEBUG
-		reinterpret_cast<byte*>(VirtualAlloc(reinterpret_cast<void*>(TEBIBYTES_OF(8)), PLATFORM_MEMORY_SIZE, MEM_RESERVE | MEM_COMMIT, PAGE_READWRITE));
-		#else
-		reinterpret_cast<byte*>(VirtualAlloc(0, PLATFORM_MEMORY_SIZE, MEM_RESERVE | MEM_COMMIT, PAGE_READWRITE));
-		#endif
+	byte*           platform_memory        = reinterpret_cast<byte*>(VirtualAlloc(0, PLATFORM_MEMORY_SIZE, MEM_RESERVE | MEM_COMMIT, PAGE_READWRITE)); // @NOTE@ `State` holds no absolute pointers, so it doesn't matter where this lands.
 
-	ASSERT(backbuffer_bitmap_data);
 	ASSERT(platform_memory);
 
+	//
+	// Initialize present ring.
+	//
+
+	DEFER
+	{
+		// @NOTE@ The present thread may still be blitting out of the slots, so each one is waited on before any of them are freed.
+		if (g_present_ring.free_semaphore)
+		{
+			FOR_RANGE(PRESENT_RING_CAPACITY)
+			{
+				WaitForSingleObject(g_present_ring.free_semaphore, INFINITE);
+			}
+		}
+
+		FOR_ELEMS(slot, g_present_ring.slots)
+		{
+			if (slot->game_framebuffer.pixels != slot->host_framebuffer.pixels)
+			{
+				VirtualFree(slot->game_framebuffer.pixels, 0, MEM_RELEASE);
+			}
+			if (slot->host_framebuffer.pixels)
+			{
+				VirtualFree(slot->host_framebuffer.pixels, 0, MEM_RELEASE);
+			}
+		}
+	};
+
+	{
+		g_present_ring.window = window;
+
+		FOR_ELEMS(slot, g_present_ring.slots)
+		{
+			slot->host_framebuffer =
+				{
+					.dims   = { BACKBUFFER_BITMAP_INFO.bmiHeader.biWidth, -BACKBUFFER_BITMAP_INFO.bmiHeader.biHeight },
+					.stride = BACKBUFFER_BITMAP_INFO.bmiHeader.biWidth, // @NOTE@ Rows of 32-bit pixels are always DWORD-aligned.
+					.format = PlatformPixelFormat::bgra,                 // @NOTE@ `BI_RGB` is laid out as B, G, R, X in memory.
+					.pixels = reinterpret_cast<u32*>(VirtualAlloc(0, static_cast<size_t>(4) * BACKBUFFER_BITMAP_INFO.bmiHeader.biWidth * -BACKBUFFER_BITMAP_INFO.bmiHeader.biHeight, MEM_COMMIT, PAGE_READWRITE))
+				};
+			ASSERT(slot->host_framebuffer.pixels);
+
+			slot->game_framebuffer = slot->host_framebuffer;
+			if (!is_game_renderable(slot->host_framebuffer))
+			{
+				slot->game_framebuffer.stride = slot->game_framebuffer.dims.x;
+				slot->game_framebuffer.format = PLATFORM_GAME_PIXEL_FORMAT;
+				slot->game_framebuffer.pixels = reinterpret_cast<u32*>(VirtualAlloc(0, static_cast<size_t>(4) * slot->game_framebuffer.dims.x * slot->game_framebuffer.dims.y, MEM_COMMIT, PAGE_READWRITE));
+				ASSERT(slot->game_framebuffer.pixels);
+			}
+		}
+
+		g_present_ring.free_semaphore  = CreateSemaphoreW(0, PRESENT_RING_CAPACITY, PRESENT_RING_CAPACITY, 0);
+		g_present_ring.ready_semaphore = CreateSemaphoreW(0, 0                    , PRESENT_RING_CAPACITY, 0);
+		if (!g_present_ring.free_semaphore || !g_present_ring.ready_semaphore)
+		{
+			DEBUG_printf(__FILE__ " :: Failed to create present ring semaphores.\n");
+			return 1;
+		}
+
+		HANDLE present_thread = CreateThread(0, 0, present_thread_procedure, 0, 0, 0);
+		if (!present_thread)
+		{
+			DEBUG_printf(__FILE__ " :: Failed to create present thread.\n");
+			return 1;
+		}
+		CloseHandle(present_thread);
+	}
+
+	//
+	// Initialize work queue.
+	//
+
+	{
+		SYSTEM_INFO system_info;
+		GetSystemInfo(&system_info);
+		i32 worker_thread_count = max(static_cast<i32>(system_info.dwNumberOfProcessors) - 1, 1);
+
+		g_work_queue.semaphore = CreateSemaphoreW(0, 0, WORK_QUEUE_CAPACITY, 0);
+		if (!g_work_queue.semaphore)
+		{
+			DEBUG_printf(__FILE__ " :: Failed to create work queue semaphore.\n");
+			return 1;
+		}
+
+		FOR_RANGE(worker_thread_count)
+		{
+			HANDLE worker_thread = CreateThread(0, 0, worker_thread_procedure, 0, 0, 0);
+			if (!worker_thread)
+			{
+				DEBUG_printf(__FILE__ " :: Failed to create worker thread.\n");
+				return 1;
+			}
+			CloseHandle(worker_thread);
+		}
+	}
+
 	if (!CopyFileW(EXE_DIR L"HandmadeRalph.dll", EXE_DIR L"HandmadeRalph.dll.temp", false))
 	{
 		ASSERT(false);
@@ -505,13 +802,15 @@ int WINAPI WinMain(HINSTANCE instance, HINSTANCE, LPSTR, int cmd_show)
 	Hotloader hotloader = DEBUG_hotload();
 	DEFER
 	{
+		complete_all_work();
 		FreeLibrary(hotloader.handle);
 		DeleteFileW(EXE_DIR L"HandmadeRalph.dll.temp");
 	};
 
 	bool32 is_computed_sample_on_time = false;
 	u64    last_computed_sample_index = 0;
-	f32    update_countdown           = 0.0f; // @TODO@ Better update timer?
+	f32    update_accumulator         = SECONDS_PER_UPDATE; // @NOTE@ Real time not yet simulated; zero or less once caught up, by how far the last update ran ahead.
+	f32    last_frame_seconds         = SECONDS_PER_UPDATE; // @NOTE@ Of real time, taken as how long the frame being started will take too.
 	i64    performance_counter_start;
 	while (true)
 	{ // @TODO@ Think about any input/frame-lag.
@@ -605,6 +904,7 @@ int WINAPI WinMain(HINSTANCE instance, HINSTANCE, LPSTR, int cmd_show)
 				&& CopyFileW(EXE_DIR L"HandmadeRalph.dll", EXE_DIR L"HandmadeRalph.dll.swap", false)
 			)
 			{
+				complete_all_work(); // @NOTE@ Queued work may point into the old DLL.
 				FreeLibrary(hotloader.handle);
 				DeleteFileW(EXE_DIR L"HandmadeRalph.dll.temp");
 				if (!MoveFile(EXE_DIR L"HandmadeRalph.dll.swap", EXE_DIR L"HandmadeRalph.dll.temp"))
@@ -616,9 +916,10 @@ int WINAPI WinMain(HINSTANCE instance, HINSTANCE, LPSTR, int cmd_show)
 		}
 		#endif
 
-		if (update_countdown <= 0.0f)
+		update_accumulator = min(update_accumulator, UPDATE_CATCH_UP_MAX * SECONDS_PER_UPDATE);
+		while (update_accumulator > 0.0f)
 		{
-			update_countdown = SECONDS_PER_UPDATE;
+			update_accumulator -= SECONDS_PER_UPDATE;
 
 			#if DEBUG
 			//
@@ -749,6 +1050,9 @@ int WINAPI WinMain(HINSTANCE instance, HINSTANCE, LPSTR, int cmd_show)
 									goto ABORT_PLAYBACK;
 								}
 
+								complete_all_work();
+								hotloader.PlatformSettle(platform_memory, PlatformFreeFileData);
+
 								DWORD resulting_write_size;
 								if (!WriteFile(playback_file, platform_memory, PLATFORM_MEMORY_SIZE, &resulting_write_size, 0) || resulting_write_size != PLATFORM_MEMORY_SIZE)
 								{
@@ -823,6 +1127,8 @@ int WINAPI WinMain(HINSTANCE instance, HINSTANCE, LPSTR, int cmd_show)
 				{
 					if (playback_input_index == 0)
 					{
+						complete_all_work();
+						hotloader.PlatformSettle(platform_memory, PlatformFreeFileData); // @NOTE@ What the current memory's holding of ours is let go of before it's overwritten.
 						memcpy(platform_memory, playback_data, PLATFORM_MEMORY_SIZE);
 					}
 
@@ -843,24 +1149,19 @@ int WINAPI WinMain(HINSTANCE instance, HINSTANCE, LPSTR, int cmd_show)
 			//
 
 			{
-				// @TODO@ Platform-agnostic pixel-layout framebuffer.
-				PlatformFramebuffer platform_framebuffer =
-					{
-						.dims   = { BACKBUFFER_BITMAP_INFO.bmiHeader.biWidth, -BACKBUFFER_BITMAP_INFO.bmiHeader.biHeight },
-						.pixels = reinterpret_cast<u32*>(backbuffer_bitmap_data)
-					};
-
 				if
 				(
-					hotloader.PlatformUpdate
+					hotloader.PlatformSimulate
 					(
-						&platform_framebuffer,
 						platform_input,
 						platform_memory,
 						SECONDS_PER_UPDATE,
 						PlatformReadFileData,
 						PlatformFreeFileData,
-						PlatformWriteFile
+						PlatformWriteFile,
+						PlatformMapFileData,
+						PlatformUnmapFileData,
+						PlatformPushWork
 					) == PlatformUpdateExitCode::abort
 				)
 				{
@@ -870,136 +1171,133 @@ int WINAPI WinMain(HINSTANCE instance, HINSTANCE, LPSTR, int cmd_show)
 			}
 
 			//
-			// Sound.
+			// Reset input.
 			//
 
+			#if DEBUG
+			PAUSE_END:;
+			#endif
+
+			FOR_ELEMS(g_platform_input.buttons)
 			{
-				DWORD player_byte_offset;
-				DWORD writer_byte_offset;
-				if (directsound_buffer->GetCurrentPosition(&player_byte_offset, &writer_byte_offset) == DS_OK)
-				{
-					ASSERT(player_byte_offset % sizeof(PlatformSample) == 0);
-					ASSERT(writer_byte_offset % sizeof(PlatformSample) == 0);
+				*it &= 0b10000000;
+			}
 
-					if (!is_computed_sample_on_time)
-					{
-						is_computed_sample_on_time = true;
-						last_computed_sample_index = writer_byte_offset / sizeof(PlatformSample);
-					}
+			g_platform_input.mouse_scroll = 0; // @NOTE@ @TODO@ Might be zeroed out while still scrolling.
+		}
 
-					i64 player_sample_index            = player_byte_offset / sizeof(PlatformSample);
-					u64 abs_last_computed_sample_index = last_computed_sample_index;
-					if (static_cast<i64>(abs_last_computed_sample_index) < player_sample_index)
-					{
-						abs_last_computed_sample_index += SOUNDBUFFER_CAPACITY;
-					}
+		//
+		// Sound.
+		//
+
+		{
+			DWORD player_byte_offset;
+			DWORD writer_byte_offset;
+			if (directsound_buffer->GetCurrentPosition(&player_byte_offset, &writer_byte_offset) == DS_OK)
+			{
+				ASSERT(player_byte_offset % sizeof(PlatformSample) == 0);
+				ASSERT(writer_byte_offset % sizeof(PlatformSample) == 0);
+
+				if (!is_computed_sample_on_time)
+				{
+					is_computed_sample_on_time = true;
+					last_computed_sample_index = writer_byte_offset / sizeof(PlatformSample);
+				}
 
-					if (abs_last_computed_sample_index >= static_cast<u64>(writer_byte_offset / sizeof(PlatformSample)) + SOUNDBUFFER_CAPACITY * (writer_byte_offset < player_byte_offset))
+				i64 player_sample_index            = player_byte_offset / sizeof(PlatformSample);
+				u64 abs_last_computed_sample_index = last_computed_sample_index;
+				if (static_cast<i64>(abs_last_computed_sample_index) < player_sample_index)
+				{
+					abs_last_computed_sample_index += SOUNDBUFFER_CAPACITY;
+				}
+
+				if (abs_last_computed_sample_index >= static_cast<u64>(writer_byte_offset / sizeof(PlatformSample)) + SOUNDBUFFER_CAPACITY * (writer_byte_offset < player_byte_offset))
+				{
+					// @NOTE@ Enough to keep the player going until the next frame's sound is in, plus some slack for the frame running long.
+					f32 seconds_until_next_frame  = clamp(last_frame_seconds - calc_performance_counter_delta_time(performance_counter_start, query_performance_counter()), 0.0f, MAXIMUM_SECONDS_PER_FRAME);
+					i64 new_computed_sample_count = player_sample_index + static_cast<i64>(ceilf(seconds_until_next_frame * SAMPLES_PER_SECOND)) + SAMPLES_OF_LATENCY - static_cast<i64>(abs_last_computed_sample_index);
+					if (new_computed_sample_count > 0)
 					{
-						i32 abs_sample_index_after_next_update = static_cast<i32>(ceilf((SECONDS_PER_UPDATE - calc_performance_counter_delta_time(performance_counter_start, query_performance_counter())) * SAMPLES_PER_SECOND));
-						i64 new_computed_sample_count          = player_sample_index + static_cast<i64>(abs_sample_index_after_next_update) - static_cast<i64>(abs_last_computed_sample_index) + (1LL + (MAXIMUM_SAMPLES_PER_UPDATE + SAMPLES_OF_LATENCY - abs_sample_index_after_next_update) / MAXIMUM_SAMPLES_PER_UPDATE) * MAXIMUM_SAMPLES_PER_UPDATE;
-						if (new_computed_sample_count > 0)
+						if (new_computed_sample_count > PLATFORM_SAMPLE_BUFFER_CAPACITY)
 						{
-							if (new_computed_sample_count > PLATFORM_SAMPLE_BUFFER_CAPACITY)
-							{
-								DEBUG_printf(__FILE__ " :: Too many samples are needed to be computed (`%d`); maximum is `%d`.\n", new_computed_sample_count, PLATFORM_SAMPLE_BUFFER_CAPACITY);
-								is_computed_sample_on_time = false;
-							}
-							else
+							DEBUG_printf(__FILE__ " :: Too many samples are needed to be computed (`%d`); maximum is `%d`.\n", new_computed_sample_count, PLATFORM_SAMPLE_BUFFER_CAPACITY);
+							is_computed_sample_on_time = false;
+						}
+						else
+						{
+							byte* region_0;
+							DWORD region_size_0;
+							byte* region_1;
+							DWORD region_size_1;
+							if (directsound_buffer->Lock(static_cast<u32>(last_computed_sample_index) * sizeof(PlatformSample), static_cast<u32>(new_computed_sample_count) * sizeof(PlatformSample), reinterpret_cast<void**>(&region_0), &region_size_0, reinterpret_cast<void**>(&region_1), &region_size_1, 0) == DS_OK)
 							{
-								byte* region_0;
-								DWORD region_size_0;
-								byte* region_1;
-								DWORD region_size_1;
-								if (directsound_buffer->Lock(static_cast<u32>(last_computed_sample_index) * sizeof(PlatformSample), static_cast<u32>(new_computed_sample_count) * sizeof(PlatformSample), reinterpret_cast<void**>(&region_0), &region_size_0, reinterpret_cast<void**>(&region_1), &region_size_1, 0) == DS_OK)
+								hotloader.PlatformSound(platform_sample_buffer, static_cast<u64>(new_computed_sample_count), SAMPLES_PER_SECOND, platform_memory);
+
+								PlatformSample* curr_sample = platform_sample_buffer;
+
+								ASSERT(region_size_0 % sizeof(PlatformSample) == 0);
+								FOR_ELEMS(sample, reinterpret_cast<u32*>(region_0), region_size_0 / sizeof(PlatformSample))
 								{
-									hotloader.PlatformSound(platform_sample_buffer, static_cast<u64>(new_computed_sample_count), SAMPLES_PER_SECOND, platform_memory);
-
-									PlatformSample* curr_sample = platform_sample_buffer;
-
-									ASSERT(region_size_0 % sizeof(PlatformSample) == 0);
-									FOR_ELEMS(sample, reinterpret_cast<u32*>(region_0), region_size_0 / sizeof(PlatformSample))
-									{
-										*sample      = curr_sample->sample;
-										curr_sample += 1;
-									}
-
-									ASSERT(region_size_1 % sizeof(PlatformSample) == 0);
-									FOR_ELEMS(sample, reinterpret_cast<u32*>(region_1), region_size_1 / sizeof(PlatformSample))
-									{
-										*sample      = curr_sample->sample;
-										curr_sample += 1;
-									}
-
-									last_computed_sample_index = (last_computed_sample_index + static_cast<u64>(new_computed_sample_count)) % SOUNDBUFFER_CAPACITY;
-									directsound_buffer->Unlock(region_0, region_size_0, region_1, region_size_1);
+									*sample      = curr_sample->sample;
+									curr_sample += 1;
 								}
-								else
+
+								ASSERT(region_size_1 % sizeof(PlatformSample) == 0);
+								FOR_ELEMS(sample, reinterpret_cast<u32*>(region_1), region_size_1 / sizeof(PlatformSample))
 								{
-									DEBUG_printf(__FILE__ " :: DirectSound :: Failed to lock soundbuffer.\n");
-									is_computed_sample_on_time = false;
+									*sample      = curr_sample->sample;
+									curr_sample += 1;
 								}
+
+								last_computed_sample_index = (last_computed_sample_index + static_cast<u64>(new_computed_sample_count)) % SOUNDBUFFER_CAPACITY;
+								directsound_buffer->Unlock(region_0, region_size_0, region_1, region_size_1);
+							}
+							else
+							{
+								DEBUG_printf(__FILE__ " :: DirectSound :: Failed to lock soundbuffer.\n");
+								is_computed_sample_on_time = false;
 							}
 						}
 					}
-					else
-					{
-						DEBUG_printf(__FILE__ " :: Cursor played over uncomputed audio in the soundbuffer.\n");
-						is_computed_sample_on_time = false;
-					}
 				}
 				else
 				{
-					DEBUG_printf(__FILE__ " :: DirectSound :: Failed to get play/write position in soundbuffer.\n");
+					DEBUG_printf(__FILE__ " :: Cursor played over uncomputed audio in the soundbuffer.\n");
 					is_computed_sample_on_time = false;
 				}
 			}
-
-			//
-			// Reset input and blit.
-			//
-
-			#if DEBUG
-			PAUSE_END:;
-			#endif
-
-			FOR_ELEMS(g_platform_input.buttons)
+			else
 			{
-				*it &= 0b10000000;
+				DEBUG_printf(__FILE__ " :: DirectSound :: Failed to get play/write position in soundbuffer.\n");
+				is_computed_sample_on_time = false;
 			}
+		}
 
-			g_platform_input.mouse_scroll = 0; // @NOTE@ @TODO@ Might be zeroed out while still scrolling.
+		//
+		// Render and present.
+		//
 
-			{
-				HDC device_context = GetDC(window);
-				StretchDIBits
-				(
-					device_context,
-					0,
-					0,
-					BACKBUFFER_BITMAP_INFO.bmiHeader.biWidth,
-					-BACKBUFFER_BITMAP_INFO.bmiHeader.biHeight,
-					0,
-					0,
-					BACKBUFFER_BITMAP_INFO.bmiHeader.biWidth,
-					-BACKBUFFER_BITMAP_INFO.bmiHeader.biHeight,
-					backbuffer_bitmap_data,
-					&BACKBUFFER_BITMAP_INFO,
-					DIB_RGB_COLORS,
-					SRCCOPY
-				);
-				ReleaseDC(window, device_context);
-			}
+		{
+			WaitForSingleObject(g_present_ring.free_semaphore, INFINITE);
+			PresentSlot* present_slot   = &g_present_ring.slots[g_present_ring.render_index];
+			g_present_ring.render_index = (g_present_ring.render_index + 1) % PRESENT_RING_CAPACITY;
+
+			hotloader.PlatformRender(&present_slot->game_framebuffer, platform_memory, 1.0f + update_accumulator / SECONDS_PER_UPDATE);
+
+			ReleaseSemaphore(g_present_ring.ready_semaphore, 1, 0);
 		}
 
 		dxgi_output->WaitForVBlank();
-		update_countdown -= calc_performance_counter_delta_time(performance_counter_start, query_performance_counter());
+		last_frame_seconds  = calc_performance_counter_delta_time(performance_counter_start, query_performance_counter());
+		update_accumulator += last_frame_seconds;
 	}
 	BREAK:;
 
+	complete_all_work();
+
 	if (g_unfreed_file_data_counter)
 	{
-		DEBUG_printf(__FILE__ " :: `%d` unfreed file data.\n", g_unfreed_file_data_counter);
+		DEBUG_printf(__FILE__ " :: `%ld` unfreed file data.\n", g_unfreed_file_data_counter);
 		return 1;
 	}
 
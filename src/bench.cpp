@@ -0,0 +1,99 @@
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wunused-function"
+
+// @NOTE@ Benches run by the headless host instead of the game, one `--bench-*` flag each; each checks what it times and fails if it comes out wrong.
+
+procedure u32 xorshift32(u32* state)
+{
+	*state ^= *state << 13;
+	*state ^= *state >> 17;
+	*state ^= *state <<  5;
+	return *state;
+}
+
+// @NOTE@ A zeroed state for a bench to build its world in, with an arena of its own. Null if there isn't the memory, with nothing left allocated.
+procedure State* allocate_bench_state(i64 arena_size)
+{
+	State* state = reinterpret_cast<State*>(calloc(1, sizeof(State)));
+	if (state)
+	{
+		state->arena      = { .size = arena_size };
+		state->arena.data = reinterpret_cast<byte*>(malloc(static_cast<size_t>(arena_size)));
+		if (!state->arena.data)
+		{
+			free(state);
+			state = 0;
+		}
+	}
+	return state;
+}
+
+procedure void free_bench_state(State* state)
+{
+	if (state)
+	{
+		free(state->arena.data);
+		free(state);
+	}
+}
+
+#include "bench_chunk_map.cpp"
+#include "bench_spatial_query.cpp"
+#include "bench_streaming.cpp"
+#include "bench_save.cpp"
+#include "bench_changes.cpp"
+#include "bench_cold_chunks.cpp"
+#include "bench_monstars.cpp"
+#include "bench_parallel_monstars.cpp"
+#include "bench_entity_kinds.cpp"
+#include "bench_spatial_hash.cpp"
+
+typedef bool32 BenchProcedure(void);
+
+struct Bench
+{
+	String          flag;
+	BenchProcedure* procedures[2]; // @NOTE@ Run in order, stopping at the first that fails; the second may be null.
+	strlit          description;
+};
+
+constexpr Bench BENCHES[] =
+	{
+		{ String("--bench-chunk-map"        ), { bench_chunk_map        , bench_chunk_lookup    }, "Time chunk map inserts, lookups, and erasures at 1k, 100k, and 1M chunks, then the chunk lookups `move` does and `move` itself, with and without the last found chunk." },
+		{ String("--bench-spatial-query"    ), { bench_spatial_query                            }, "Time rect, radius, and line entity queries with thousands of entities around each." },
+		{ String("--bench-streaming"        ), { bench_streaming                                }, "Fly the camera out across a large world and back, timing the streaming each frame and checking every tree came back." },
+		{ String("--bench-save"             ), { bench_save                                     }, "Time saving and loading a large world with most of its regions on disk, checking it all comes back the same." },
+		{ String("--bench-changes"          ), { bench_changes                                  }, "Time finding the chunks changed since a generation against scanning every chunk, at 1, 100, and 10k changes." },
+		{ String("--bench-cold-chunks"      ), { bench_cold_chunks                              }, "Let a large world go cold, then thaw it all back out, checking every chunk comes back the same." },
+		{ String("--bench-monstars"         ), { bench_monstars         , bench_monstar_layouts }, "Time spawning, updating, and despawning 1k and 4k monstars, then checking the despawned ones left no handles on their tiles; then their timers and offsets as structs against as arrays at 1k, 10k, and 100k." },
+		{ String("--bench-parallel-monstars"), { bench_parallel_monstars                        }, "Update 4k monstars on the main thread alone and with their chunks handed out to the worker threads, and check both come out the same." },
+		{ String("--bench-entity-kinds"     ), { bench_entity_kinds                             }, "Time going over the sim region's 4k monstars and the pet a kind at a time against all together switching on type, and check both do the same." },
+		{ String("--bench-spatial-hash"     ), { bench_spatial_hash                             }, "Time building a spatial hash over 100k points and radius queries into it, checking each query against every point." },
+	};
+
+// @NOTE@ Null if `flag` isn't any bench's.
+procedure const Bench* find_bench(String flag)
+{
+	FOR_ELEMS(it, BENCHES)
+	{
+		if (it->flag == flag)
+		{
+			return it;
+		}
+	}
+	return 0;
+}
+
+procedure bool32 run_bench(const Bench* bench)
+{
+	FOR_ELEMS(it, bench->procedures)
+	{
+		if (*it && !(*it)())
+		{
+			return false;
+		}
+	}
+	return true;
+}
+
+#pragma clang diagnostic pop
@@ -0,0 +1,76 @@
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wunused-function"
+
+procedure bool32 bench_changes(void)
+{
+	constexpr i32 WORLD_CHUNK_DIM = 256;
+	constexpr i32 REPEAT_COUNT    = 16;
+	constexpr i32 CHANGE_COUNTS[] = { 1, 100, 10'000 };
+
+	State* state = allocate_bench_state(MEBIBYTES_OF(512));
+	DEFER { free_bench_state(state); };
+	if (!state)
+	{
+		printf(__FILE__ " :: Failed to allocate memory.\n");
+		return false;
+	}
+
+	FOR_RANGE(chunk_iy, -WORLD_CHUNK_DIM / 2, WORLD_CHUNK_DIM / 2)
+	{
+		FOR_RANGE(chunk_ix, -WORLD_CHUNK_DIM / 2, WORLD_CHUNK_DIM / 2)
+		{
+			if (!get_or_create_chunk(state, vi2 { chunk_ix, chunk_iy } * CHUNK_DIM))
+			{
+				printf(__FILE__ " :: Failed to create chunks.\n");
+				return false;
+			}
+		}
+	}
+
+	printf(":: %d chunks\n", static_cast<i32>(state->chunk_map.count));
+
+	u32 seed = 0xC0FFEE;
+	FOR_ELEMS(change_count, CHANGE_COUNTS)
+	{
+		f64 seconds_walk = 0.0;
+		f64 seconds_scan = 0.0;
+		i64 walk_count   = 0;
+		i64 scan_count   = 0;
+		FOR_RANGE(REPEAT_COUNT)
+		{
+			u64 generation = state->change_generation;
+			FOR_RANGE(*change_count)
+			{
+				vi2    coords = { static_cast<i32>(xorshift32(&seed) % (WORLD_CHUNK_DIM * CHUNK_DIM)) - WORLD_CHUNK_DIM * CHUNK_DIM / 2, static_cast<i32>(xorshift32(&seed) % (WORLD_CHUNK_DIM * CHUNK_DIM)) - WORLD_CHUNK_DIM * CHUNK_DIM / 2 };
+				Chunk* chunk  = find_chunk(state, coords);
+				set_tile_entity(state, chunk, coords, {});
+			}
+
+			f64 seconds_start = query_seconds();
+			FOR_CHANGED_CHUNKS(chunk, state, generation)
+			{
+				walk_count += 1;
+			}
+			seconds_walk += query_seconds() - seconds_start;
+
+			seconds_start = query_seconds();
+			FOR_ELEMS(slot, state->chunk_map.slots, state->chunk_map.capacity)
+			{
+				scan_count += slot->distance && slot->value->change_generation > generation;
+			}
+			seconds_scan += query_seconds() - seconds_start;
+		}
+
+		if (walk_count != scan_count)
+		{
+			printf(__FILE__ " :: Walking the changed chunks found `%d` where scanning every chunk found `%d`.\n", static_cast<i32>(walk_count), static_cast<i32>(scan_count));
+			return false;
+		}
+
+		printf(":: %6d changes : %10.1f us walking the changed chunks, %10.1f us scanning every chunk, %8.1f chunks changed\n", *change_count, seconds_walk * 1'000'000.0 / REPEAT_COUNT, seconds_scan * 1'000'000.0 / REPEAT_COUNT, static_cast<f64>(walk_count) / REPEAT_COUNT);
+	}
+
+	return true;
+}
+
+#pragma clang diagnostic pop
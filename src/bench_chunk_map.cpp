@@ -0,0 +1,340 @@
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wunused-function"
+
+procedure bool32 bench_chunk_map(void)
+{
+	constexpr i32 CHUNK_COUNTS[] = { 1'000, 100'000, 1'000'000 };
+
+	MemoryArena arena = { .size = GIBIBYTES_OF(1) };
+	arena.data = reinterpret_cast<byte*>(malloc(static_cast<size_t>(arena.size)));
+	DEFER { free(arena.data); };
+	if (!arena.data)
+	{
+		printf(__FILE__ " :: Failed to allocate memory.\n");
+		return false;
+	}
+
+	FOR_ELEMS(chunk_count, CHUNK_COUNTS)
+	{
+		arena.used = 0;
+
+		// @NOTE@ A square-ish block of chunks visited in random order, and just as many chunks far outside of it for misses.
+		i32  side        = static_cast<i32>(ceilf(sqrtf(static_cast<f32>(*chunk_count))));
+		vi2* hit_coords  = allocate<vi2>(&arena, *chunk_count);
+		vi2* miss_coords = allocate<vi2>(&arena, *chunk_count);
+		if (!hit_coords || !miss_coords)
+		{
+			printf(__FILE__ " :: Failed to allocate memory.\n");
+			return false;
+		}
+
+		FOR_RANGE(i, *chunk_count)
+		{
+			hit_coords [i] = vi2 { i % side - side / 2, i / side - side / 2 } * CHUNK_DIM;
+			miss_coords[i] = hit_coords[i] + vi2 { side * CHUNK_DIM * 4, 0 };
+		}
+
+		u32 seed = 0x12345678;
+		FOR_RANGE_REV(i, *chunk_count)
+		{
+			i32 j = static_cast<i32>(xorshift32(&seed) % static_cast<u32>(i + 1));
+			vi2 t = hit_coords[i];
+			hit_coords[i] = hit_coords[j];
+			hit_coords[j] = t;
+		}
+
+		// @NOTE@ The values are never dereferenced; they're only distinct pointers to check lookups against.
+		lambda chunk_of = [&](i32 i) { return reinterpret_cast<Chunk*>(&hit_coords[i]); };
+
+		ChunkMap map = {};
+
+		f64 seconds_start = query_seconds();
+		FOR_RANGE(i, *chunk_count)
+		{
+			if (!insert(&map, &arena, hit_coords[i], chunk_of(i)))
+			{
+				printf(__FILE__ " :: Ran out of memory inserting `%d` chunks.\n", *chunk_count);
+				return false;
+			}
+		}
+		f64 insert_seconds = query_seconds() - seconds_start;
+
+		i32 probe_max = 0;
+		i64 probe_sum = 0;
+		FOR_ELEMS(it, map.slots, map.capacity)
+		{
+			probe_max  = max(probe_max, it->distance);
+			probe_sum += it->distance;
+		}
+
+		i32 wrong_count = 0;
+
+		seconds_start = query_seconds();
+		FOR_RANGE(i, *chunk_count)
+		{
+			wrong_count += find(&map, hit_coords[i]) != chunk_of(i);
+		}
+		f64 hit_seconds = query_seconds() - seconds_start;
+
+		seconds_start = query_seconds();
+		FOR_RANGE(i, *chunk_count)
+		{
+			wrong_count += find(&map, miss_coords[i]) != 0;
+		}
+		f64 miss_seconds = query_seconds() - seconds_start;
+
+		seconds_start = query_seconds();
+		FOR_RANGE(i, *chunk_count / 2)
+		{
+			wrong_count += erase(&map, hit_coords[i * 2]) != chunk_of(i * 2);
+		}
+		f64 erase_seconds = query_seconds() - seconds_start;
+
+		FOR_RANGE(i, *chunk_count)
+		{
+			wrong_count += find(&map, hit_coords[i]) != (i % 2 || i / 2 >= *chunk_count / 2 ? chunk_of(i) : 0);
+		}
+
+		if (wrong_count)
+		{
+			printf(__FILE__ " :: Chunk map returned `%d` wrong results with `%d` chunks.\n", wrong_count, *chunk_count);
+			return false;
+		}
+
+		printf
+		(
+			":: %9d chunks : insert %6.1f ns, hit %6.1f ns, miss %6.1f ns, erase %6.1f ns : load %.2f, mean probe %.2f, max probe %d\n",
+			*chunk_count,
+			insert_seconds * 1'000'000'000.0 / *chunk_count,
+			hit_seconds    * 1'000'000'000.0 / *chunk_count,
+			miss_seconds   * 1'000'000'000.0 / *chunk_count,
+			erase_seconds  * 1'000'000'000.0 / (*chunk_count / 2),
+			static_cast<f64>(*chunk_count) / static_cast<f64>(map.capacity),
+			static_cast<f64>(probe_sum) / static_cast<f64>(*chunk_count),
+			probe_max
+		);
+	}
+
+	return true;
+}
+
+// @NOTE@ Monstars packed a few to a chunk, each taking a random step every tick. Every tick they go chunk by chunk, the way the sim region gathers them,
+// so a move's chunks are often the last move's too. First the two lookups each move does, replayed on their own with the ways chunk coordinates have
+// been worked out, then `move` itself, once with the last found chunk forgotten before every move and once with it only forgotten every tick like the
+// game does.
+procedure bool32 bench_chunk_lookup(void)
+{
+	constexpr i32 CHUNK_BLOCK_DIM    = 64;
+	constexpr i32 MONSTAR_CHUNK_DIM  = 16;  // @NOTE@ The block of chunks in the middle the monstars start in.
+	constexpr i32 MONSTARS_PER_CHUNK = 16;
+	constexpr i32 MONSTAR_COUNT      = MONSTAR_CHUNK_DIM * MONSTAR_CHUNK_DIM * MONSTARS_PER_CHUNK;
+	constexpr i32 TICK_COUNT         = 256; // @NOTE@ Too few for any monstar to wander out of the world.
+	constexpr i32 MOVE_COUNT         = MONSTAR_COUNT * TICK_COUNT;
+	static_assert(MONSTAR_COUNT <= (1 << MONSTAR_SLOT_BITS));
+	static_assert((MONSTAR_CHUNK_DIM / 2) * CHUNK_DIM + TICK_COUNT < (CHUNK_BLOCK_DIM / 2) * CHUNK_DIM);
+
+	State*    states[2]     = { allocate_bench_state(MEBIBYTES_OF(64)), allocate_bench_state(MEBIBYTES_OF(64)) };
+	vi2*      coords        = reinterpret_cast<vi2*     >(malloc(MONSTAR_COUNT * sizeof(vi2     )));
+	u16*      order         = reinterpret_cast<u16*     >(malloc(MOVE_COUNT    * sizeof(u16     )));
+	Cardinal* movements     = reinterpret_cast<Cardinal*>(malloc(MOVE_COUNT    * sizeof(Cardinal)));
+	vi2*      lookup_coords = reinterpret_cast<vi2*     >(malloc(MOVE_COUNT    * sizeof(vi2     ) * 2));
+	DEFER
+	{
+		FOR_ELEMS(it, states)
+		{
+			free_bench_state(*it);
+		}
+		free(coords);
+		free(order);
+		free(movements);
+		free(lookup_coords);
+	};
+
+	if (!states[0] || !states[1] || !coords || !order || !movements || !lookup_coords)
+	{
+		printf(__FILE__ " :: Failed to allocate memory.\n");
+		return false;
+	}
+
+	// @NOTE@ The monstars by chunk, with a counting sort over the chunks of the world.
+	lambda order_by_chunk =
+		[&](u16* tick_order)
+		{
+			lambda chunk_index_of =
+				[](vi2 coords)
+				{
+					vi2 chunk_coords = chunk_coords_of(coords) / CHUNK_DIM + vx2(CHUNK_BLOCK_DIM / 2);
+					return chunk_coords.y * CHUNK_BLOCK_DIM + chunk_coords.x;
+				};
+
+			i32 offsets[CHUNK_BLOCK_DIM * CHUNK_BLOCK_DIM + 1] = {};
+			FOR_ELEMS(it, coords, MONSTAR_COUNT)
+			{
+				offsets[chunk_index_of(*it) + 1] += 1;
+			}
+			FOR_RANGE(i, 1, capacityof(offsets))
+			{
+				offsets[i] += offsets[i - 1];
+			}
+			FOR_ELEMS(it, coords, MONSTAR_COUNT)
+			{
+				tick_order[offsets[chunk_index_of(*it)]]  = static_cast<u16>(it_index);
+				offsets[chunk_index_of(*it)]             += 1;
+			}
+		};
+
+	{
+		i32 count = 0;
+		FOR_RANGE(chunk_iy, -MONSTAR_CHUNK_DIM / 2, MONSTAR_CHUNK_DIM / 2)
+		{
+			FOR_RANGE(chunk_ix, -MONSTAR_CHUNK_DIM / 2, MONSTAR_CHUNK_DIM / 2)
+			{
+				FOR_RANGE(i, MONSTARS_PER_CHUNK)
+				{
+					coords[count]  = vi2 { chunk_ix, chunk_iy } * CHUNK_DIM + vi2 { i % 4, i / 4 } * (CHUNK_DIM / 4);
+					count         += 1;
+				}
+			}
+		}
+	}
+
+	FOR_ELEMS(state, states)
+	{
+		FOR_RANGE(chunk_iy, -CHUNK_BLOCK_DIM / 2, CHUNK_BLOCK_DIM / 2)
+		{
+			FOR_RANGE(chunk_ix, -CHUNK_BLOCK_DIM / 2, CHUNK_BLOCK_DIM / 2)
+			{
+				if (!get_or_create_chunk(*state, vi2 { chunk_ix, chunk_iy } * CHUNK_DIM))
+				{
+					printf(__FILE__ " :: Failed to create chunks.\n");
+					return false;
+				}
+			}
+		}
+
+		if (spawn_monstars(*state, coords, MONSTAR_COUNT, 0.0) != MONSTAR_COUNT)
+		{
+			printf(__FILE__ " :: Failed to spawn monstars.\n");
+			return false;
+		}
+	}
+
+	u32 seed = 0x9E3779B9;
+	FOR_ELEMS(it, movements, MOVE_COUNT)
+	{
+		*it = static_cast<Cardinal>(xorshift32(&seed) % capacityof(META_Cardinal));
+	}
+
+	//
+	// The lookups alone, walked on from where the monstars were spawned as if nothing were ever in the way.
+	//
+
+	FOR_RANGE(tick, TICK_COUNT)
+	{
+		u16* tick_order = &order[tick * MONSTAR_COUNT];
+		order_by_chunk(tick_order);
+		FOR_ELEMS(it, tick_order, MONSTAR_COUNT)
+		{
+			i32 move_index = tick * MONSTAR_COUNT + static_cast<i32>(it_index);
+			lookup_coords[move_index * 2 + 0] = coords[*it];
+			lookup_coords[move_index * 2 + 1] = coords[*it] + META_Cardinal[movements[tick * MONSTAR_COUNT + *it]].vi;
+			coords[*it]                       = lookup_coords[move_index * 2 + 1];
+		}
+	}
+
+	// @NOTE@ How `get_chunk` used to floor coordinates into chunk coordinates.
+	lambda division_chunk_coords_of =
+		[](vi2 coords)
+		{
+			return vi2
+				{
+					CHUNK_DIM * (coords.x / CHUNK_DIM + (coords.x < 0 && coords.x % CHUNK_DIM ? -1 : 0)),
+					CHUNK_DIM * (coords.y / CHUNK_DIM + (coords.y < 0 && coords.y % CHUNK_DIM ? -1 : 0))
+				};
+		};
+
+	u64 checksums[3] = {};
+	f64 seconds  [3] = {};
+
+	f64 seconds_start = query_seconds();
+	FOR_ELEMS(it, lookup_coords, MOVE_COUNT * 2)
+	{
+		checksums[0] += reinterpret_cast<u64>(find(&states[0]->chunk_map, division_chunk_coords_of(*it)));
+	}
+	seconds[0] = query_seconds() - seconds_start;
+
+	seconds_start = query_seconds();
+	FOR_ELEMS(it, lookup_coords, MOVE_COUNT * 2)
+	{
+		checksums[1] += reinterpret_cast<u64>(find(&states[0]->chunk_map, chunk_coords_of(*it)));
+	}
+	seconds[1] = query_seconds() - seconds_start;
+
+	seconds_start = query_seconds();
+	FOR_RANGE(tick, TICK_COUNT)
+	{
+		states[0]->last_found_chunk = 0;
+		FOR_ELEMS(it, &lookup_coords[tick * MONSTAR_COUNT * 2], MONSTAR_COUNT * 2)
+		{
+			checksums[2] += reinterpret_cast<u64>(find_chunk(states[0], *it));
+		}
+	}
+	seconds[2] = query_seconds() - seconds_start;
+
+	if (checksums[0] != checksums[1] || checksums[1] != checksums[2])
+	{
+		printf(__FILE__ " :: Chunk lookups disagree.\n");
+		return false;
+	}
+
+	printf(":: move lookups : division + map %5.1f ns, shift/mask + map %5.1f ns, find_chunk %5.1f ns\n", seconds[0] * 1'000'000'000.0 / MOVE_COUNT, seconds[1] * 1'000'000'000.0 / MOVE_COUNT, seconds[2] * 1'000'000'000.0 / MOVE_COUNT);
+
+	//
+	// `move` itself, a tick of each at a time so whatever else the machine's doing weighs on both alike.
+	//
+
+	seconds[0] = 0.0;
+	seconds[1] = 0.0;
+	FOR_RANGE(tick, TICK_COUNT)
+	{
+		// @NOTE@ Both worlds are the same at every tick, so one order does for both.
+		FOR_ELEMS(it, states[0]->monstars.elems, states[0]->monstars.count)
+		{
+			coords[it_index] = it->coords;
+		}
+		u16* tick_order = &order[tick * MONSTAR_COUNT];
+		order_by_chunk(tick_order);
+
+		FOR_ELEMS(state, states)
+		{
+			bool32 is_forgetful = state_index == 0;
+
+			seconds_start = query_seconds();
+			(*state)->last_found_chunk = 0;
+			FOR_ELEMS(it, tick_order, MONSTAR_COUNT)
+			{
+				if (is_forgetful)
+				{
+					(*state)->last_found_chunk = 0;
+				}
+				move(*state, ref(&(*state)->monstars.elems[*it]), movements[tick * MONSTAR_COUNT + *it]);
+			}
+			seconds[state_index] += query_seconds() - seconds_start;
+		}
+	}
+
+	FOR_ELEMS(it, states[0]->monstars.elems, states[0]->monstars.count)
+	{
+		if (it->coords != states[1]->monstars.elems[it_index].coords)
+		{
+			printf(__FILE__ " :: Monstars ended up in different places with and without the last found chunk.\n");
+			return false;
+		}
+	}
+
+	printf(":: move : %5.1f ns forgetting the last found chunk every move, %5.1f ns only every tick (%.2fx)\n", seconds[0] * 1'000'000'000.0 / MOVE_COUNT, seconds[1] * 1'000'000'000.0 / MOVE_COUNT, seconds[0] / seconds[1]);
+
+	return true;
+}
+
+#pragma clang diagnostic pop
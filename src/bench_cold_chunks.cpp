@@ -0,0 +1,150 @@
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wunused-function"
+
+procedure bool32 bench_cold_chunks(void)
+{
+	constexpr i32 WORLD_CHUNK_DIM = 128;
+
+	State* state = allocate_bench_state(MEBIBYTES_OF(256));
+	DEFER { free_bench_state(state); };
+	if (!state)
+	{
+		printf(__FILE__ " :: Failed to allocate memory.\n");
+		return false;
+	}
+
+	FOR_RANGE(chunk_iy, -WORLD_CHUNK_DIM / 2, WORLD_CHUNK_DIM / 2)
+	{
+		FOR_RANGE(chunk_ix, -WORLD_CHUNK_DIM / 2, WORLD_CHUNK_DIM / 2)
+		{
+			Chunk* chunk = get_or_create_chunk(state, vi2 { chunk_ix, chunk_iy } * CHUNK_DIM);
+			if (!chunk)
+			{
+				printf(__FILE__ " :: Failed to create chunks.\n");
+				return false;
+			}
+
+			Tree trees[CHUNK_GENERATED_TREE_MAX];
+			fill_chunk(state, chunk, trees, generate_chunk_trees(trees, chunk->coords));
+		}
+	}
+
+	// @NOTE@ Order-independent, and over everything of a chunk from its summary on and its change generation, so a thawed chunk has to come back exactly as it was.
+	lambda checksum_chunks =
+		[&]()
+		{
+			u64 checksum = 0;
+			FOR_ELEMS(slot, state->chunk_map.slots, state->chunk_map.capacity)
+			{
+				if (slot->distance)
+				{
+					u64 hash = hash_coords(slot->value->coords) ^ slot->value->change_generation;
+					FOR_ELEMS(it, reinterpret_cast<byte*>(static_cast<Chunk*>(slot->value)) + offsetof(Chunk, summary), sizeof(Chunk) - offsetof(Chunk, summary))
+					{
+						hash = (hash ^ *it) * 0x100000001B3;
+					}
+					FOR_ELEMS(it, slot->value->trees, slot->value->tree_count)
+					{
+						hash = (hash ^ hash_coords(it->coords) ^ static_cast<u64>(it->bmp_index)) * 0x100000001B3;
+					}
+					checksum += hash;
+				}
+			}
+			return checksum;
+		};
+
+	// @NOTE@ Freezing and thawing aren't changes, so the chunks changed since halfway through making the world have to be found the same the whole way through.
+	u64 generation_before = state->change_generation;
+	u64 generation_half   = generation_before / 2;
+	lambda count_changed_chunks =
+		[&]()
+		{
+			i64 count = 0;
+			FOR_CHANGED_CHUNKS(chunk, state, generation_half)
+			{
+				count += 1;
+			}
+			FOR_CHANGED_COLD_CHUNKS(cold_chunk, state, generation_half)
+			{
+				count += 1;
+			}
+			return count;
+		};
+
+	i64 chunk_count     = state->chunk_map.count;
+	u64 checksum_before = checksum_chunks();
+	i64 changed_count   = count_changed_chunks();
+
+	//
+	// Freeze.
+	//
+
+	// @NOTE@ Everything but the chunks around the hero and the camera at the origin goes cold. A slot a chunk's been frozen out of gets looked at again,
+	// so the sweep takes up to two passes over the chunk map's slots.
+	f64 seconds_total = 0.0;
+	f64 seconds_worst = 0.0;
+	i32 tick_count    = COLD_CHUNK_TICKS + 2 * static_cast<i32>(state->chunk_map.capacity / COLD_CHUNK_SWEEP_SLOTS + 1);
+	FOR_RANGE(tick_count)
+	{
+		f64 seconds_start = query_seconds();
+		update_cold_chunks(state);
+		f64 seconds = query_seconds() - seconds_start;
+
+		seconds_total += seconds;
+		seconds_worst  = max(seconds_worst, seconds);
+	}
+
+	aliasing stats      = state->cold_chunks.stats;
+	f64      warm_bytes = static_cast<f64>(state->cold_chunks.warm_bytes) / max(stats.cold_chunk_count, 1);
+	f64      cold_bytes = static_cast<f64>(stats.cold_chunk_bytes)        / max(stats.cold_chunk_count, 1);
+	printf(":: %d chunks of %d to %d trees\n", static_cast<i32>(chunk_count), CHUNK_GENERATED_TREE_MAX / 2, CHUNK_GENERATED_TREE_MAX);
+	printf(":: update_cold_chunks : %8.1f us/tick on average, %8.1f us at worst, over %d ticks\n", seconds_total * 1'000'000.0 / max(tick_count, 1), seconds_worst * 1'000'000.0, tick_count);
+	printf(":: tiers              : %d warm, %d cold, %d compressed\n", static_cast<i32>(state->chunk_map.count), stats.cold_chunk_count, stats.compress_count);
+	printf(":: memory             : %.0f bytes a chunk warm, %.0f bytes cold (%.1fx as many chunks in the same memory), %.1f KiB saved\n", warm_bytes, cold_bytes, warm_bytes / cold_bytes, static_cast<f64>(stats.saved_bytes) / 1024.0);
+
+	if (state->chunk_map.count + state->cold_chunks.chunks.count != chunk_count || !stats.cold_chunk_count)
+	{
+		printf(__FILE__ " :: Chunks went missing going cold.\n");
+		return false;
+	}
+	if (state->change_generation != generation_before || count_changed_chunks() != changed_count)
+	{
+		printf(__FILE__ " :: Changes went missing going cold.\n");
+		return false;
+	}
+
+	//
+	// Thaw.
+	//
+
+	f64 seconds_start = query_seconds();
+	FOR_RANGE(chunk_iy, -WORLD_CHUNK_DIM / 2, WORLD_CHUNK_DIM / 2)
+	{
+		FOR_RANGE(chunk_ix, -WORLD_CHUNK_DIM / 2, WORLD_CHUNK_DIM / 2)
+		{
+			if (!find_or_thaw_chunk(state, vi2 { chunk_ix, chunk_iy } * CHUNK_DIM))
+			{
+				printf(__FILE__ " :: Failed to thaw chunks.\n");
+				return false;
+			}
+		}
+	}
+	f64 seconds_thaw = query_seconds() - seconds_start;
+
+	printf(":: thawing            : %8.2f us/chunk, %d decompressed\n", seconds_thaw * 1'000'000.0 / max(stats.decompress_count, 1), stats.decompress_count);
+
+	if (state->cold_chunks.chunks.count || stats.decompress_count != stats.compress_count || checksum_chunks() != checksum_before)
+	{
+		printf(__FILE__ " :: Chunks differ after being thawed.\n");
+		return false;
+	}
+	if (state->change_generation != generation_before || count_changed_chunks() != changed_count)
+	{
+		printf(__FILE__ " :: Changes differ after being thawed.\n");
+		return false;
+	}
+
+	return true;
+}
+
+#pragma clang diagnostic pop
@@ -0,0 +1,179 @@
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wunused-function"
+
+// @NOTE@ The sim region's creatures gone over a kind at a time, through the dense arrays and batch dispatch `META/kind/Entity.h` generates, against
+// all of them gone over in one array the way the sim region used to have them, switching on each one's type.
+procedure bool32 bench_entity_kinds(void)
+{
+	constexpr i32 WORLD_CHUNK_DIM = 8;
+	constexpr i32 MONSTAR_COUNT   = 4'000;
+	constexpr i32 PASS_COUNT      = 1'000;
+	constexpr i32 SPAWN_DIM       = 2 * SIM_REGION_RADIUS + CHUNK_DIM; // @NOTE@ Exactly the sim region's chunks around the origin.
+	static_assert(MONSTAR_COUNT + 1 <= SIM_REGION_ENTITY_CAPACITY);
+	static_assert(MONSTAR_COUNT + 2 <= SPAWN_DIM * SPAWN_DIM);
+
+	State* state = allocate_bench_state(MEBIBYTES_OF(64));
+	DEFER { free_bench_state(state); };
+	if (!state)
+	{
+		printf(__FILE__ " :: Failed to allocate memory.\n");
+		return false;
+	}
+
+	FOR_RANGE(chunk_iy, -WORLD_CHUNK_DIM / 2, WORLD_CHUNK_DIM / 2)
+	{
+		FOR_RANGE(chunk_ix, -WORLD_CHUNK_DIM / 2, WORLD_CHUNK_DIM / 2)
+		{
+			if (!get_or_create_chunk(state, vi2 { chunk_ix, chunk_iy } * CHUNK_DIM))
+			{
+				printf(__FILE__ " :: Failed to create chunks.\n");
+				return false;
+			}
+		}
+	}
+	state->pet.coords = state->hero.coords + vi2 { 1, 0 };
+	set_tile_entity(state, find_chunk(state, state->hero.coords), state->hero.coords, handle_of(EntityType::Hero));
+	set_tile_entity(state, find_chunk(state, state->pet.coords ), state->pet.coords , handle_of(EntityType::Pet ));
+
+	// @NOTE@ Every tile of the sim region but the hero's and the pet's, shuffled.
+	vi2 spawn_coords[SPAWN_DIM * SPAWN_DIM - 2];
+	{
+		i32 count = 0;
+		FOR_RANGE(y, -SIM_REGION_RADIUS, SIM_REGION_RADIUS + CHUNK_DIM)
+		{
+			FOR_RANGE(x, -SIM_REGION_RADIUS, SIM_REGION_RADIUS + CHUNK_DIM)
+			{
+				if (vi2 { x, y } != state->hero.coords && vi2 { x, y } != state->pet.coords)
+				{
+					spawn_coords[count]  = { x, y };
+					count               += 1;
+				}
+			}
+		}
+
+		u32 seed = 0xC0FFEE;
+		FOR_RANGE_REV(i, count)
+		{
+			u32 j = xorshift32(&seed) % static_cast<u32>(i + 1);
+			SWAP(&spawn_coords[i], &spawn_coords[j]);
+		}
+	}
+
+	if (spawn_monstars(state, spawn_coords, MONSTAR_COUNT, state->sim_time) != MONSTAR_COUNT)
+	{
+		printf(__FILE__ " :: Failed to spawn monstars.\n");
+		return false;
+	}
+
+	aliasing region = state->sim_region;
+	begin_sim_region(state, state->sim_time);
+	if (region.entity_count != MONSTAR_COUNT + 1)
+	{
+		printf(__FILE__ " :: Gathered `%d` creatures into the sim region where there were `%d`.\n", region.entity_count, MONSTAR_COUNT + 1);
+		return false;
+	}
+
+	// @NOTE@ The monstars in the order they were gathered, with the pet partway through.
+	EntityHandle mixed[MONSTAR_COUNT + 1];
+	FOR_Entity_Monstar(it, &region.entities)
+	{
+		mixed[it_index] = *it;
+	}
+	mixed[MONSTAR_COUNT]     = mixed[MONSTAR_COUNT / 2];
+	mixed[MONSTAR_COUNT / 2] = region.entities.Pet_[0];
+
+	//
+	// Stamp everyone simulated, like `end_sim_region`.
+	//
+
+	f64 seconds_start = query_seconds();
+	FOR_RANGE(PASS_COUNT)
+	{
+		state->sim_time += 1.0;
+		FOR_ELEMS(it, mixed)
+		{
+			EntityRef entity = entity_of(state, 0, *it);
+			Pet*      pet;
+			Monstar*  monstar;
+			if (deref(&pet, entity))
+			{
+				pet->simulated_time = state->sim_time;
+			}
+			else if (deref(&monstar, entity))
+			{
+				monstar->simulated_time = state->sim_time;
+			}
+		}
+	}
+	f64 seconds_switched = query_seconds() - seconds_start;
+
+	seconds_start = query_seconds();
+	FOR_RANGE(PASS_COUNT)
+	{
+		state->sim_time += 1.0;
+		end_sim_region(state);
+	}
+	f64 seconds_dispatched = query_seconds() - seconds_start;
+
+	printf(":: %5d creatures stamped : %6.2f ns/creature switching on type, %6.2f ns/creature dispatched by kind, %5.2fx\n", region.entity_count, seconds_switched * 1'000'000'000.0 / PASS_COUNT / region.entity_count, seconds_dispatched * 1'000'000'000.0 / PASS_COUNT / region.entity_count, seconds_switched / seconds_dispatched);
+
+	if (state->pet.simulated_time != state->sim_time)
+	{
+		printf(__FILE__ " :: The pet wasn't stamped.\n");
+		return false;
+	}
+	FOR_ELEMS(it, state->monstars.elems, state->monstars.count)
+	{
+		if (it->simulated_time != state->sim_time)
+		{
+			printf(__FILE__ " :: Monstar `%d` wasn't stamped.\n", static_cast<i32>(it_index));
+			return false;
+		}
+	}
+
+	//
+	// Total up the monstars' hit points, like any system that only wants monstars.
+	//
+
+	i64 switched_hp = 0;
+	seconds_start = query_seconds();
+	FOR_RANGE(PASS_COUNT)
+	{
+		FOR_ELEMS(it, mixed)
+		{
+			Monstar* monstar;
+			if (deref(&monstar, entity_of(state, 0, *it)))
+			{
+				switched_hp += monstar->hp;
+			}
+		}
+	}
+	seconds_switched = query_seconds() - seconds_start;
+
+	i64 iterated_hp = 0;
+	seconds_start = query_seconds();
+	FOR_RANGE(PASS_COUNT)
+	{
+		FOR_Entity_Monstar(it, &region.entities)
+		{
+			Monstar* monstar = find(&state->monstars, index_of(*it));
+			if (monstar)
+			{
+				iterated_hp += monstar->hp;
+			}
+		}
+	}
+	f64 seconds_iterated = query_seconds() - seconds_start;
+
+	printf(":: %5d monstars totaled  : %6.2f ns/monstar switching on type, %6.2f ns/monstar iterated by kind, %5.2fx\n", MONSTAR_COUNT, seconds_switched * 1'000'000'000.0 / PASS_COUNT / MONSTAR_COUNT, seconds_iterated * 1'000'000'000.0 / PASS_COUNT / MONSTAR_COUNT, seconds_switched / seconds_iterated);
+
+	if (switched_hp != iterated_hp || iterated_hp != static_cast<i64>(3) * MONSTAR_COUNT * PASS_COUNT)
+	{
+		printf(__FILE__ " :: Totaled `%lld` hit points switching on type and `%lld` iterating by kind.\n", switched_hp, iterated_hp);
+		return false;
+	}
+
+	return true;
+}
+
+#pragma clang diagnostic pop
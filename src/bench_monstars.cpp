@@ -0,0 +1,324 @@
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wunused-function"
+
+procedure bool32 bench_monstars(void)
+{
+	constexpr i32 WORLD_CHUNK_DIM   = 8;
+	constexpr i32 MONSTAR_COUNTS[]  = { 1'000, 4'000 };
+	constexpr i32 TICK_COUNT        = 240;
+	constexpr f32 SECONDS_PER_TICK  = 1.0f / 60.0f;
+	constexpr i32 SPAWN_DIM         = 2 * SIM_REGION_RADIUS + CHUNK_DIM; // @NOTE@ Exactly the sim region's chunks around the origin.
+	static_assert(MONSTAR_COUNTS[capacityof(MONSTAR_COUNTS) - 1] <= (1 << MONSTAR_SLOT_BITS));
+	static_assert(MONSTAR_COUNTS[capacityof(MONSTAR_COUNTS) - 1] <  SPAWN_DIM * SPAWN_DIM);
+
+	State* state = allocate_bench_state(MEBIBYTES_OF(64));
+	DEFER { free_bench_state(state); };
+	if (!state)
+	{
+		printf(__FILE__ " :: Failed to allocate memory.\n");
+		return false;
+	}
+
+	FOR_RANGE(chunk_iy, -WORLD_CHUNK_DIM / 2, WORLD_CHUNK_DIM / 2)
+	{
+		FOR_RANGE(chunk_ix, -WORLD_CHUNK_DIM / 2, WORLD_CHUNK_DIM / 2)
+		{
+			if (!get_or_create_chunk(state, vi2 { chunk_ix, chunk_iy } * CHUNK_DIM))
+			{
+				printf(__FILE__ " :: Failed to create chunks.\n");
+				return false;
+			}
+		}
+	}
+	set_tile_entity(state, find_chunk(state, state->hero.coords), state->hero.coords, handle_of(EntityType::Hero));
+
+	// @NOTE@ Every tile of the sim region but the hero's, shuffled.
+	vi2 spawn_coords[SPAWN_DIM * SPAWN_DIM - 1];
+	{
+		i32 count = 0;
+		FOR_RANGE(y, -SIM_REGION_RADIUS, SIM_REGION_RADIUS + CHUNK_DIM)
+		{
+			FOR_RANGE(x, -SIM_REGION_RADIUS, SIM_REGION_RADIUS + CHUNK_DIM)
+			{
+				if (vi2 { x, y } != state->hero.coords)
+				{
+					spawn_coords[count]  = { x, y };
+					count               += 1;
+				}
+			}
+		}
+
+		u32 seed = 0xC0FFEE;
+		FOR_RANGE_REV(i, count)
+		{
+			u32 j = xorshift32(&seed) % static_cast<u32>(i + 1);
+			SWAP(&spawn_coords[i], &spawn_coords[j]);
+		}
+	}
+
+	u32 stale_indices[capacityof(MONSTAR_COUNTS)];
+	FOR_ELEMS(monstar_count, MONSTAR_COUNTS)
+	{
+		//
+		// Spawn.
+		//
+
+		f64 seconds_start = query_seconds();
+		i32 spawned_count = spawn_monstars(state, spawn_coords, *monstar_count, state->sim_time);
+		f64 seconds_spawn = query_seconds() - seconds_start;
+		if (spawned_count != *monstar_count)
+		{
+			printf(__FILE__ " :: Failed to spawn monstars.\n");
+			return false;
+		}
+
+		//
+		// Update.
+		//
+
+		i64 simulated_count = 0;
+		seconds_start = query_seconds();
+		FOR_RANGE(TICK_COUNT)
+		{
+			f64 previous_sim_time = state->sim_time;
+			state->sim_time         += SECONDS_PER_TICK;
+			state->last_found_chunk  = 0;
+
+			begin_sim_region(state, previous_sim_time);
+			update_monstars(state, SECONDS_PER_TICK, 0);
+			end_sim_region(state);
+			simulated_count += state->sim_region.entity_count;
+		}
+		f64 seconds_update = query_seconds() - seconds_start;
+
+		if (simulated_count != static_cast<i64>(*monstar_count) * TICK_COUNT)
+		{
+			printf(__FILE__ " :: Simulated `%d` monstars a tick where `%d` were spawned.\n", static_cast<i32>(simulated_count / TICK_COUNT), *monstar_count);
+			return false;
+		}
+
+		//
+		// Despawn every other monstar in bulk, taking them off their tiles.
+		//
+
+		i32  despawn_count = *monstar_count / 2;
+		u32* indices       = reinterpret_cast<u32*>(malloc(static_cast<size_t>(despawn_count) * sizeof(u32)));
+		DEFER { free(indices); };
+		if (!indices)
+		{
+			printf(__FILE__ " :: Failed to allocate memory.\n");
+			return false;
+		}
+		FOR_ELEMS(it, indices, despawn_count)
+		{
+			*it = pool_index_of(&state->monstars, &state->monstars.elems[it_index * 2]);
+		}
+		// @NOTE@ Swap-removing moves elements around, so every other one is picked by index rather than by where it currently is.
+		stale_indices[monstar_count_index] = indices[0];
+
+		seconds_start = query_seconds();
+		remove_monstars(state, indices, despawn_count);
+		f64 seconds_despawn = query_seconds() - seconds_start;
+
+		//
+		// Look for any handle left behind.
+		//
+
+		i32 stale_count = 0;
+		i32 tile_count  = 0;
+		seconds_start = query_seconds();
+		FOR_ELEMS(slot, state->chunk_map.slots, state->chunk_map.capacity)
+		{
+			if (slot->distance)
+			{
+				FOR_ELEMS(it, &slot->value->tiles[0][0], CHUNK_DIM * CHUNK_DIM)
+				{
+					stale_count += type_of(*it) == EntityType::Monstar && !find(&state->monstars, index_of(*it));
+				}
+				tile_count += CHUNK_DIM * CHUNK_DIM;
+			}
+		}
+		f64 seconds_stale = query_seconds() - seconds_start;
+
+		printf(":: %5d monstars : spawned in %8.1f us, %8.1f us/tick (%6.1f ns/monstar), half despawned in %8.1f us, %6.2f ns/tile checking for stale handles, %d found\n", *monstar_count, seconds_spawn * 1'000'000.0, seconds_update * 1'000'000.0 / TICK_COUNT, seconds_update * 1'000'000'000.0 / static_cast<f64>(simulated_count), seconds_despawn * 1'000'000.0, seconds_stale * 1'000'000'000.0 / tile_count, stale_count);
+
+		if (stale_count || state->monstars.count != *monstar_count - despawn_count)
+		{
+			printf(__FILE__ " :: Found `%d` stale handles and `%d` monstars left after despawning `%d`.\n", stale_count, state->monstars.count, despawn_count);
+			return false;
+		}
+
+		// @NOTE@ Every monstar left is still where its tile says it is.
+		FOR_ELEMS(it, state->monstars.elems, state->monstars.count)
+		{
+			EntityHandle tile = find_chunk(state, it->coords)->tiles[rel_coords_of(it->coords).y][rel_coords_of(it->coords).x];
+			Monstar*     monstar;
+			if (!deref(&monstar, entity_of(state, 0, tile)) || monstar != it)
+			{
+				printf(__FILE__ " :: A monstar's tile lost track of it.\n");
+				return false;
+			}
+		}
+
+		//
+		// Clear out the world for the next round.
+		//
+
+		FOR_ELEMS(slot, state->chunk_map.slots, state->chunk_map.capacity)
+		{
+			if (slot->distance)
+			{
+				FOR_RANGE(y, CHUNK_DIM)
+				{
+					FOR_RANGE(x, CHUNK_DIM)
+					{
+						if (type_of(slot->value->tiles[y][x]) == EntityType::Monstar)
+						{
+							set_tile_entity(state, slot->value, slot->value->coords + vi2 { x, y }, {});
+						}
+					}
+				}
+			}
+		}
+		while (state->monstars.count)
+		{
+			despawn(&state->monstars, pool_index_of(&state->monstars, &state->monstars.elems[0]));
+		}
+	}
+
+	// @NOTE@ Handles from earlier rounds stay stale even though their slots have been reused since.
+	FOR_ELEMS(it, stale_indices)
+	{
+		if (find(&state->monstars, *it))
+		{
+			printf(__FILE__ " :: A despawned monstar's handle came back to life.\n");
+			return false;
+		}
+	}
+	printf(":: %d pool slots used over every round, the rest reused\n", state->monstars.slot_count);
+
+	return true;
+}
+
+// @NOTE@ The timers and offsets of `integrate_monstars`, against the same update done over monstars laid out the way `Monstar` used to have them.
+procedure bool32 bench_monstar_layouts(void)
+{
+	constexpr i32 MONSTAR_COUNTS[] = { 1'000, 10'000, 100'000 };
+	constexpr i32 CAPACITY         = MONSTAR_COUNTS[capacityof(MONSTAR_COUNTS) - 1];
+	constexpr i32 TICK_COUNT       = 240;
+	constexpr f32 SECONDS_PER_TICK = 1.0f / 60.0f;
+
+	struct AoSMonstar
+	{
+		vi2         coords;
+		vf3         rel_pos;
+		Cardinal    cardinal;
+		f32         hover_t;
+		f32         move_t;
+		i32         hp;
+		f32         existence_t;
+		MonstarFlag flag;
+		f64         simulated_time;
+	};
+
+	typedef MonstarHot<CAPACITY> SoAMonstars;
+
+	AoSMonstar*  aos = reinterpret_cast<AoSMonstar *>(calloc(CAPACITY, sizeof(AoSMonstar)));
+	SoAMonstars* soa = reinterpret_cast<SoAMonstars*>(calloc(1, sizeof(SoAMonstars)));
+	DEFER { free(aos); free(soa); };
+	if (!aos || !soa)
+	{
+		printf(__FILE__ " :: Failed to allocate memory.\n");
+		return false;
+	}
+
+	FOR_ELEMS(monstar_count, MONSTAR_COUNTS)
+	{
+		// @NOTE@ Some of each: flying or not, fast or not, and a few already dying.
+		u32 seed = 0xBEEF;
+		FOR_ELEMS(it, aos, *monstar_count)
+		{
+			*it =
+				{
+					.rel_pos     = { static_cast<f32>(xorshift32(&seed) % 1000) / 1000.0f - 0.5f, static_cast<f32>(xorshift32(&seed) % 1000) / 1000.0f - 0.5f, 0.0f },
+					.hover_t     = static_cast<f32>(xorshift32(&seed) % 1000) / 1000.0f,
+					.hp          = xorshift32(&seed) % 8 ? 2 : 0,
+					.existence_t = 1.0f,
+					.flag        = static_cast<MonstarFlag>(xorshift32(&seed) % 4),
+				};
+			if (+(it->flag & MonstarFlag::flying))
+			{
+				it->rel_pos.z = 2.0f;
+			}
+
+			soa->rel_pos_x   [it_index] = it->rel_pos.x;
+			soa->rel_pos_y   [it_index] = it->rel_pos.y;
+			soa->rel_pos_z   [it_index] = it->rel_pos.z;
+			soa->hover_t     [it_index] = it->hover_t;
+			soa->move_t      [it_index] = it->move_t;
+			soa->existence_t [it_index] = it->existence_t;
+			soa->hover_period[it_index] = +(it->flag & MonstarFlag::flying) ? 3.0f  : 0.0f;
+			soa->move_period [it_index] = +(it->flag & MonstarFlag::fast  ) ? 0.25f : 0.75f;
+			soa->update      [it_index] = static_cast<u32>(it->hp ? MonstarUpdate::alive : MonstarUpdate::dying);
+		}
+
+		//
+		// Array of structs.
+		//
+
+		f64 seconds_start = query_seconds();
+		FOR_RANGE(TICK_COUNT)
+		{
+			FOR_ELEMS(it, aos, *monstar_count)
+			{
+				if (it->hp)
+				{
+					it->rel_pos.xy = dampen(it->rel_pos.xy, { 0.0f, 0.0f }, 0.01f, SECONDS_PER_TICK);
+					if (+(it->flag & MonstarFlag::flying))
+					{
+						it->hover_t += SECONDS_PER_TICK / 3.0f;
+						if (it->hover_t >= 1.0f)
+						{
+							it->hover_t -= 1.0f;
+						}
+					}
+					it->move_t += SECONDS_PER_TICK / (+(it->flag & MonstarFlag::fast) ? 0.25f : 0.75f);
+				}
+				else
+				{
+					it->existence_t = max(it->existence_t - SECONDS_PER_TICK / 1.0f, 0.0f);
+					it->rel_pos.z   = dampen(it->rel_pos.z, 0.0f, 0.1f, SECONDS_PER_TICK);
+				}
+			}
+		}
+		f64 seconds_aos = query_seconds() - seconds_start;
+
+		//
+		// Struct of arrays.
+		//
+
+		seconds_start = query_seconds();
+		FOR_RANGE(TICK_COUNT)
+		{
+			integrate_monstars(soa, *monstar_count, SECONDS_PER_TICK);
+		}
+		f64 seconds_soa = query_seconds() - seconds_start;
+
+		printf(":: %6d monstars : %8.1f us/tick (%5.2f ns/monstar) as structs, %8.1f us/tick (%5.2f ns/monstar) as arrays, %5.2fx\n", *monstar_count, seconds_aos * 1'000'000.0 / TICK_COUNT, seconds_aos * 1'000'000'000.0 / TICK_COUNT / *monstar_count, seconds_soa * 1'000'000.0 / TICK_COUNT, seconds_soa * 1'000'000'000.0 / TICK_COUNT / *monstar_count, seconds_aos / seconds_soa);
+
+		FOR_ELEMS(it, aos, *monstar_count)
+		{
+			f32 aos_fields[] = { it->rel_pos.x, it->rel_pos.y, it->rel_pos.z, it->hover_t, it->move_t, it->existence_t };
+			f32 soa_fields[] = { soa->rel_pos_x[it_index], soa->rel_pos_y[it_index], soa->rel_pos_z[it_index], soa->hover_t[it_index], soa->move_t[it_index], soa->existence_t[it_index] };
+			if (memcmp(aos_fields, soa_fields, sizeof(aos_fields)))
+			{
+				printf(__FILE__ " :: Monstar `%d` came out differently as arrays than as structs.\n", static_cast<i32>(it_index));
+				return false;
+			}
+		}
+	}
+
+	return true;
+}
+
+#pragma clang diagnostic pop
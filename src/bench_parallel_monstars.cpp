@@ -0,0 +1,186 @@
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wunused-function"
+
+// @NOTE@ Needs the work queue. Two copies of the same world, one updated on the main thread alone and one with the chunks handed out to the workers,
+// have to come out exactly the same: the monstars, the tiles, and the order the chunks changed in.
+procedure bool32 bench_parallel_monstars(void)
+{
+	constexpr i32 WORLD_CHUNK_DIM  = 8;
+	constexpr i32 MONSTAR_COUNT    = 4'000;
+	constexpr i32 TICK_COUNT       = 600;
+	constexpr f32 SECONDS_PER_TICK = 1.0f / 60.0f;
+	constexpr i32 SPAWN_DIM        = 2 * SIM_REGION_RADIUS + CHUNK_DIM;
+	static_assert(MONSTAR_COUNT <= (1 << MONSTAR_SLOT_BITS) && MONSTAR_COUNT < SPAWN_DIM * SPAWN_DIM);
+
+	State* states[2] = { allocate_bench_state(MEBIBYTES_OF(64)), allocate_bench_state(MEBIBYTES_OF(64)) };
+	DEFER { free_bench_state(states[0]); free_bench_state(states[1]); };
+	if (!states[0] || !states[1])
+	{
+		printf(__FILE__ " :: Failed to allocate memory.\n");
+		return false;
+	}
+
+	// @NOTE@ Every tile of the sim region but the hero's, shuffled.
+	vi2 spawn_coords[SPAWN_DIM * SPAWN_DIM - 1];
+	{
+		i32 count = 0;
+		FOR_RANGE(y, -SIM_REGION_RADIUS, SIM_REGION_RADIUS + CHUNK_DIM)
+		{
+			FOR_RANGE(x, -SIM_REGION_RADIUS, SIM_REGION_RADIUS + CHUNK_DIM)
+			{
+				if (vi2 { x, y } != vi2 { 0, 0 })
+				{
+					spawn_coords[count]  = { x, y };
+					count               += 1;
+				}
+			}
+		}
+
+		u32 seed = 0xC0FFEE;
+		FOR_RANGE_REV(i, count)
+		{
+			u32 j = xorshift32(&seed) % static_cast<u32>(i + 1);
+			SWAP(&spawn_coords[i], &spawn_coords[j]);
+		}
+	}
+
+	FOR_ELEMS(it, states)
+	{
+		State* state = *it;
+		FOR_RANGE(chunk_iy, -WORLD_CHUNK_DIM / 2, WORLD_CHUNK_DIM / 2)
+		{
+			FOR_RANGE(chunk_ix, -WORLD_CHUNK_DIM / 2, WORLD_CHUNK_DIM / 2)
+			{
+				if (!get_or_create_chunk(state, vi2 { chunk_ix, chunk_iy } * CHUNK_DIM))
+				{
+					printf(__FILE__ " :: Failed to create chunks.\n");
+					return false;
+				}
+			}
+		}
+		set_tile_entity(state, find_chunk(state, state->hero.coords), state->hero.coords, handle_of(EntityType::Hero));
+		state->hero.hp = 1'000'000;
+
+		if (spawn_monstars(state, spawn_coords, MONSTAR_COUNT, state->sim_time) != MONSTAR_COUNT)
+		{
+			printf(__FILE__ " :: Failed to spawn monstars.\n");
+			return false;
+		}
+	}
+	DEFER { complete_all_work(); }; // @NOTE@ Stale pushes of the step jobs may still be queued, and they look at the states.
+
+	//
+	// Update both.
+	//
+
+	f64 seconds_updates[2]  = {};
+	i64 step_count          = 0;
+	i64 deferred_step_count = 0;
+	i64 job_count           = 0;
+	FOR_RANGE(tick, TICK_COUNT)
+	{
+		FOR_ELEMS(it, states)
+		{
+			State* state = *it;
+			f64    previous_sim_time = state->sim_time;
+			state->sim_time         += SECONDS_PER_TICK;
+			state->last_found_chunk  = 0;
+
+			// @NOTE@ The hero walks a small square, knocking into whatever's in the way, and every so often a few monstars drop dead.
+			if (tick % 20 == 0)
+			{
+				move(state, ref(&state->hero), static_cast<Cardinal>(tick / 20 % capacityof(META_Cardinal)));
+				handle_interactions(state);
+			}
+			if (tick % 100 == 50)
+			{
+				FOR_ELEMS(monstar, state->monstars.elems, state->monstars.count)
+				{
+					if (monstar_index % 7 == 0)
+					{
+						monstar->hp = 0;
+					}
+				}
+			}
+
+			begin_sim_region(state, previous_sim_time);
+			f64 seconds_start = query_seconds();
+			update_monstars(state, SECONDS_PER_TICK, it_index ? PlatformPushWork : 0);
+			seconds_updates[it_index] += query_seconds() - seconds_start;
+			end_sim_region(state);
+		}
+
+		aliasing steps = states[1]->monstar_steps;
+		FOR_ELEMS(it, steps.steps, states[1]->sim_region.entities.counts[static_cast<i32>(EntityType::Monstar)])
+		{
+			step_count          += *it != MonstarStep::none;
+			deferred_step_count += *it == MonstarStep::deferred;
+		}
+		job_count += steps.job_count;
+	}
+
+	printf(":: %d monstars : %8.1f us/tick on the main thread, %8.1f us/tick in %.1f jobs a tick with %d worker threads, %.1f%% of steps deferred, %d left\n", MONSTAR_COUNT, seconds_updates[0] * 1'000'000.0 / TICK_COUNT, seconds_updates[1] * 1'000'000.0 / TICK_COUNT, static_cast<f64>(job_count) / TICK_COUNT, clamp(static_cast<i32>(sysconf(_SC_NPROCESSORS_ONLN)) - 1, 1, WORKER_THREAD_MAX), 100.0 * static_cast<f64>(deferred_step_count) / static_cast<f64>(max(step_count, static_cast<i64>(1))), states[0]->monstars.count);
+
+	//
+	// Compare.
+	//
+
+	lambda differ =
+		[](const char* what)
+		{
+			printf(__FILE__ " :: The worlds' %s differ after updating in parallel.\n", what);
+			return false;
+		};
+
+	aliasing a = *states[0];
+	aliasing b = *states[1];
+	if (a.monstars.count != b.monstars.count || a.monstars.slot_count != b.monstars.slot_count)
+	{
+		return differ("monstar counts");
+	}
+	FOR_ELEMS(it, a.monstars.elems, a.monstars.count)
+	{
+		Monstar* other = &b.monstars.elems[it_index];
+		if (it->coords != other->coords || it->cardinal != other->cardinal || it->hp != other->hp || it->flag != other->flag || a.monstars.elem_slots[it_index] != b.monstars.elem_slots[it_index])
+		{
+			return differ("monstars");
+		}
+	}
+	FOR_RANGE(lane, a.monstars.HOT_LANE_COUNT)
+	{
+		if (memcmp(hot_lanes_of(&a.monstars, lane), hot_lanes_of(&b.monstars, lane), static_cast<u64>(a.monstars.count) * sizeof(u32)))
+		{
+			return differ("monstars' timers and offsets");
+		}
+	}
+	if (a.hero.coords != b.hero.coords || a.hero.hp != b.hero.hp || memcmp(&a.hero.rel_pos, &b.hero.rel_pos, sizeof(a.hero.rel_pos)))
+	{
+		return differ("heroes");
+	}
+	if (a.change_generation != b.change_generation)
+	{
+		return differ("change generations");
+	}
+	Chunk* chunk = a.changed_chunks;
+	Chunk* other = b.changed_chunks;
+	while (chunk || other)
+	{
+		if
+		(
+			(!chunk || !other)                                          ||
+			(chunk->coords != other->coords)                            ||
+			(chunk->change_generation != other->change_generation)      ||
+			(memcmp(chunk->tiles, other->tiles, sizeof(chunk->tiles)))  ||
+			(memcmp(&chunk->summary, &other->summary, sizeof(chunk->summary)))
+		)
+		{
+			return differ("chunks");
+		}
+		chunk = chunk->next_changed_chunk;
+		other = other->next_changed_chunk;
+	}
+
+	return true;
+}
+
+#pragma clang diagnostic pop
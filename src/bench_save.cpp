@@ -0,0 +1,175 @@
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wunused-function"
+
+// @NOTE@ Needs the work queue; the save and region files go into `EXE_DIR`.
+procedure bool32 bench_save(void)
+{
+	constexpr i32 WORLD_REGION_DIM = 32;
+	constexpr i32 WORLD_DIM        = WORLD_REGION_DIM * REGION_DIM;
+	constexpr i32 EVICT_FRAME_MAX  = 600;
+	constexpr i32 SETTLE_FRAME_MAX = 600;
+	constexpr i32 REPEAT_COUNT     = 4;
+
+	State*      state   = allocate_bench_state(MEBIBYTES_OF(512));
+	MemoryArena scratch = { .size = MEBIBYTES_OF(512) };
+	scratch.data = reinterpret_cast<byte*>(malloc(static_cast<size_t>(scratch.size)));
+	DEFER { free_bench_state(state); free(scratch.data); };
+	if (!state || !scratch.data)
+	{
+		printf(__FILE__ " :: Failed to allocate memory.\n");
+		return false;
+	}
+	state->streaming.radius = WORLD_DIM;
+
+	u32 seed = 0xC0FFEE;
+	FOR_RANGE(chunk_iy, -WORLD_DIM / CHUNK_DIM / 2, WORLD_DIM / CHUNK_DIM / 2)
+	{
+		FOR_RANGE(chunk_ix, -WORLD_DIM / CHUNK_DIM / 2, WORLD_DIM / CHUNK_DIM / 2)
+		{
+			Chunk* chunk = get_or_create_chunk(state, vi2 { chunk_ix, chunk_iy } * CHUNK_DIM);
+			if (!chunk)
+			{
+				printf(__FILE__ " :: Failed to create chunks.\n");
+				return false;
+			}
+
+			i32 tree_count = static_cast<i32>(CHUNK_GENERATED_TREE_MAX / 2 + xorshift32(&seed) % (CHUNK_GENERATED_TREE_MAX / 2));
+			FOR_RANGE(tree_count)
+			{
+				vi2 coords;
+				do
+				{
+					coords = chunk->coords + vi2 { static_cast<i32>(xorshift32(&seed) % CHUNK_DIM), static_cast<i32>(xorshift32(&seed) % CHUNK_DIM) };
+				}
+				while (test(&chunk->occupied_bitmap, rel_coords_of(coords)));
+
+				if (!add_tree(state, chunk, coords, static_cast<i32>(xorshift32(&seed) % 3)))
+				{
+					printf(__FILE__ " :: Failed to add trees.\n");
+					return false;
+				}
+			}
+		}
+	}
+
+	state->hero.coords           = { 1, 1 };
+	state->hero.hp               = 4;
+	state->pressure_plate.coords = { 2, 1 };
+	state->camera_coords         = { 7, -3 };
+	state->sim_time              = 12.5;
+	{
+		Chunk* chunk = find_chunk(state, state->hero.coords);
+		set_tile_entity(state, chunk, state->hero.coords, {});
+		set_tile_entity(state, chunk, state->hero.coords, handle_of(EntityType::Hero));
+		set_tile_entity(state, chunk, state->pressure_plate.coords, {});
+		set_tile_pressure_plate(state, chunk, state->pressure_plate.coords, &state->pressure_plate);
+	}
+
+	// @NOTE@ Order-independent, and covers the tiles themselves, so it catches anything of a chunk that didn't make it through.
+	lambda checksum_world =
+		[&]()
+		{
+			u64 checksum = hash_coords(state->hero.coords) ^ hash_coords(state->camera_coords) ^ static_cast<u64>(state->sim_time * 1000.0);
+			FOR_ELEMS(slot, state->chunk_map.slots, state->chunk_map.capacity)
+			{
+				if (slot->distance)
+				{
+					Chunk* chunk = slot->value;
+					FOR_ELEMS(it, chunk->trees, chunk->tree_count)
+					{
+						checksum += hash_coords(it->coords) ^ static_cast<u64>(it->bmp_index);
+					}
+					FOR_ELEMS(it, &chunk->tiles[0][0], CHUNK_DIM * CHUNK_DIM)
+					{
+						checksum += hash_coords(chunk->coords + vi2 { static_cast<i32>(it_index) % CHUNK_DIM, static_cast<i32>(it_index) / CHUNK_DIM }) * it->bits;
+					}
+					checksum += hash_coords(chunk->coords) * static_cast<u64>(count_set_tiles(&chunk->occupied_bitmap) + chunk->summary.pressure_plate_count * 1000);
+				}
+			}
+			return checksum;
+		};
+	u64 checksum_whole = checksum_world();
+
+	// @NOTE@ Shrinking the radius evicts most of the world, so the save has to carry the region files too.
+	state->streaming.radius = WORLD_DIM / 4;
+	FOR_RANGE(EVICT_FRAME_MAX)
+	{
+		state->last_found_chunk = 0;
+		update_streaming(state, PlatformReadFileData, PlatformFreeFileData, PlatformWriteFile, PlatformPushWork);
+	}
+	finish_streaming_jobs(state, PlatformFreeFileData, true);
+
+	i32 resident_chunk_count = static_cast<i32>(state->chunk_map.count);
+	i32 stored_region_count  = 0;
+	FOR_ELEMS(slot, state->streaming.regions.slots, state->streaming.regions.capacity)
+	{
+		stored_region_count += slot->distance && slot->value->status == RegionStatus::stored;
+	}
+	u64 checksum_resident = checksum_world();
+
+	String file_path     = String(EXE_DIR "bench_world.sav");
+	f64    seconds_save  = 0.0;
+	f64    seconds_load  = 0.0;
+	u64    file_size     = 0;
+	FOR_RANGE(REPEAT_COUNT)
+	{
+		f64 seconds_start = query_seconds();
+		if (!save_world(state, &scratch, file_path, PlatformReadFileData, PlatformFreeFileData, PlatformWriteFile))
+		{
+			printf(__FILE__ " :: Failed to save the world.\n");
+			return false;
+		}
+		seconds_save += query_seconds() - seconds_start;
+
+		seconds_start = query_seconds();
+		if (!load_world(state, file_path, PlatformMapFileData, PlatformUnmapFileData, PlatformFreeFileData, PlatformWriteFile))
+		{
+			printf(__FILE__ " :: Failed to load the world.\n");
+			return false;
+		}
+		seconds_load += query_seconds() - seconds_start;
+
+		if (checksum_world() != checksum_resident || state->chunk_map.count != resident_chunk_count)
+		{
+			printf(__FILE__ " :: World differs after saving and loading it back in.\n");
+			return false;
+		}
+	}
+
+	{
+		PlatformFileData file_data = PlatformMapFileData(file_path);
+		if (!file_data.data)
+		{
+			return false;
+		}
+		file_size = file_data.size;
+		PlatformUnmapFileData(&file_data);
+	}
+
+	printf(":: %dx%d regions of %dx%d chunks, %d chunks resident and %d regions stored\n", WORLD_REGION_DIM, WORLD_REGION_DIM, REGION_DIM_IN_CHUNKS, REGION_DIM_IN_CHUNKS, resident_chunk_count, stored_region_count);
+	printf(":: save file  : %.1f MiB (a playback dump is %.1f MiB)\n", static_cast<f64>(file_size) / 1024.0 / 1024.0, static_cast<f64>(PLATFORM_MEMORY_SIZE) / 1024.0 / 1024.0);
+	printf(":: save_world : %8.2f ms (%.0f MiB/s)\n", seconds_save * 1000.0 / REPEAT_COUNT, static_cast<f64>(file_size) / 1024.0 / 1024.0 / (seconds_save / REPEAT_COUNT));
+	printf(":: load_world : %8.2f ms (%.0f MiB/s)\n", seconds_load * 1000.0 / REPEAT_COUNT, static_cast<f64>(file_size) / 1024.0 / 1024.0 / (seconds_load / REPEAT_COUNT));
+
+	// @NOTE@ Streaming everything back in from the region files the load put back on disk should give the whole world as it was before it was saved.
+	state->streaming.radius = WORLD_DIM;
+	FOR_RANGE(SETTLE_FRAME_MAX)
+	{
+		state->last_found_chunk = 0;
+		update_streaming(state, PlatformReadFileData, PlatformFreeFileData, PlatformWriteFile, PlatformPushWork);
+		if (state->streaming.stats.stored_region_count == 0 && state->streaming.stats.resident_region_count == square(WORLD_REGION_DIM))
+		{
+			break;
+		}
+	}
+
+	if (state->streaming.stats.failure_count || state->streaming.stats.stored_region_count || checksum_world() != checksum_whole)
+	{
+		printf(__FILE__ " :: World differs after streaming the saved regions back in.\n");
+		return false;
+	}
+
+	return true;
+}
+
+#pragma clang diagnostic pop
@@ -0,0 +1,155 @@
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wunused-function"
+
+// @NOTE@ Points scattered about as densely as creatures can be packed, on both sides of the origin so cells get floored the right way, and onto exact
+// distances from the query centers. Every query has to find exactly what checking every point would.
+procedure bool32 bench_spatial_hash(void)
+{
+	constexpr i32 POINT_COUNT       = 100'000;
+	constexpr f32 WORLD_DIM         = 320.0f;
+	constexpr f32 CELL_DIM          = 2.0f;
+	constexpr i32 BUILD_COUNT       = 100;
+	constexpr i32 QUERY_COUNT       = 10'000;
+	constexpr i32 CHECKED_QUERY_MAX = 200;
+	constexpr f32 RADIUS            = 3.0f;
+	constexpr f64 BUILD_BUDGET      = 0.001;
+
+	MemoryArena arena = { .size = MEBIBYTES_OF(64) };
+	arena.data = reinterpret_cast<byte*>(malloc(static_cast<size_t>(arena.size)));
+	DEFER { free(arena.data); };
+	vf2* positions = reinterpret_cast<vf2*>(malloc(POINT_COUNT * sizeof(vf2)));
+	DEFER { free(positions); };
+	vf2* centers = reinterpret_cast<vf2*>(malloc(QUERY_COUNT * sizeof(vf2)));
+	DEFER { free(centers); };
+	i32* seen = reinterpret_cast<i32*>(malloc(POINT_COUNT * sizeof(i32)));
+	DEFER { free(seen); };
+	if (!arena.data || !positions || !centers || !seen)
+	{
+		printf(__FILE__ " :: Failed to allocate memory.\n");
+		return false;
+	}
+
+	lambda random_position =
+		[&](u32* seed)
+		{
+			return vf2 { static_cast<f32>(xorshift32(seed) >> 8), static_cast<f32>(xorshift32(seed) >> 8) } / static_cast<f32>(1 << 24) * WORLD_DIM - vx2(WORLD_DIM / 2.0f);
+		};
+
+	u32 seed = 0xC0FFEE;
+	FOR_ELEMS(it, centers, QUERY_COUNT)
+	{
+		*it = random_position(&seed);
+	}
+	FOR_ELEMS(it, positions, POINT_COUNT)
+	{
+		*it = random_position(&seed);
+	}
+	// @NOTE@ Right on the edge of the first queries' radii.
+	FOR_RANGE(i, CHECKED_QUERY_MAX)
+	{
+		positions[i] = centers[i] + vf2 { i % 2 ? RADIUS : 0.0f, i % 2 ? 0.0f : -RADIUS };
+	}
+
+	//
+	// Build.
+	//
+
+	SpatialHash hash = {};
+	f64 seconds_start = query_seconds();
+	FOR_RANGE(BUILD_COUNT)
+	{
+		arena.used = 0;
+		hash       = build_spatial_hash(&arena, positions, POINT_COUNT, CELL_DIM);
+	}
+	f64 seconds_build = (query_seconds() - seconds_start) / BUILD_COUNT;
+
+	printf(":: %6d points : built in %7.1f us (%5.2f ns/point), %s the %.0f us budget\n", POINT_COUNT, seconds_build * 1'000'000.0, seconds_build * 1'000'000'000.0 / POINT_COUNT, seconds_build < BUILD_BUDGET ? "within" : "over", BUILD_BUDGET * 1'000'000.0);
+
+	if (!hash.bucket_starts)
+	{
+		printf(__FILE__ " :: Failed to build the spatial hash.\n");
+		return false;
+	}
+
+	//
+	// Query.
+	//
+
+	i64 found_count         = 0;
+	i64 checked_found_count = 0;
+	seconds_start = query_seconds();
+	FOR_ELEMS(center, centers, QUERY_COUNT)
+	{
+		if (center_index == CHECKED_QUERY_MAX)
+		{
+			checked_found_count = found_count;
+		}
+
+		SpatialHashQuery query = begin_radius_query(&hash, *center, RADIUS);
+		i32              index;
+		while (next(&index, 0, &query))
+		{
+			found_count += 1;
+		}
+	}
+	f64 seconds_query = query_seconds() - seconds_start;
+
+	i64 brute_force_count = 0;
+	seconds_start = query_seconds();
+	FOR_ELEMS(center, centers, CHECKED_QUERY_MAX)
+	{
+		FOR_ELEMS(it, positions, POINT_COUNT)
+		{
+			brute_force_count += square(it->x - center->x) + square(it->y - center->y) <= square(RADIUS);
+		}
+	}
+	f64 seconds_brute_force = query_seconds() - seconds_start;
+
+	printf(":: %6d radius queries : %7.1f ns/query, %5.1f points/query, %9.1f ns/query checking every point\n", QUERY_COUNT, seconds_query * 1'000'000'000.0 / QUERY_COUNT, static_cast<f64>(found_count) / QUERY_COUNT, seconds_brute_force * 1'000'000'000.0 / CHECKED_QUERY_MAX);
+
+	if (checked_found_count != brute_force_count)
+	{
+		printf(__FILE__ " :: The first `%d` radius queries found `%lld` points where there were `%lld`.\n", CHECKED_QUERY_MAX, checked_found_count, brute_force_count);
+		return false;
+	}
+
+	//
+	// Check.
+	//
+
+	memset(seen, 0xFF, POINT_COUNT * sizeof(i32));
+	FOR_ELEMS(center, centers, CHECKED_QUERY_MAX)
+	{
+		DEFER_ARENA_RESET(&arena);
+		SpatialHashResult result = query_radius(&arena, &hash, *center, RADIUS);
+
+		i32 expected_count = 0;
+		FOR_ELEMS(it, positions, POINT_COUNT)
+		{
+			expected_count += square(it->x - center->x) + square(it->y - center->y) <= square(RADIUS);
+		}
+
+		bool32 found_edge = false;
+		FOR_ELEMS(it, result.indices, result.count)
+		{
+			vf2 position = positions[*it];
+			if (seen[*it] == center_index || square(position.x - center->x) + square(position.y - center->y) > square(RADIUS))
+			{
+				printf(__FILE__ " :: Radius query `%d` found point `%d` twice or too far away.\n", static_cast<i32>(center_index), *it);
+				return false;
+			}
+			seen[*it]   = static_cast<i32>(center_index);
+			found_edge |= *it == center_index;
+		}
+
+		if (result.count != expected_count || !found_edge)
+		{
+			printf(__FILE__ " :: Radius query `%d` found `%d` points where there were `%d`.\n", static_cast<i32>(center_index), result.count, expected_count);
+			return false;
+		}
+	}
+
+	return true;
+}
+
+#pragma clang diagnostic pop
@@ -0,0 +1,183 @@
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wunused-function"
+
+procedure bool32 bench_spatial_query(void)
+{
+	constexpr i32 WORLD_CHUNK_DIM = 32;
+	constexpr i32 WORLD_DIM       = WORLD_CHUNK_DIM * CHUNK_DIM;
+	constexpr i32 QUERY_COUNT     = 10'000;
+	constexpr i32 RECT_DIM        = 48;
+	constexpr i32 RADIUS          = 24;
+	constexpr i32 LINE_LENGTH     = 64;
+
+	State* state = allocate_bench_state(MEBIBYTES_OF(256));
+	DEFER { free_bench_state(state); };
+	if (!state)
+	{
+		printf(__FILE__ " :: Failed to allocate memory.\n");
+		return false;
+	}
+
+	// @NOTE@ Every other tile on average is occupied, so a query's neighborhood holds thousands of entities.
+	u32 seed       = 0xC0FFEE;
+	i32 tree_count = 0;
+	FOR_RANGE(y, -WORLD_DIM / 2, WORLD_DIM / 2)
+	{
+		FOR_RANGE(x, -WORLD_DIM / 2, WORLD_DIM / 2)
+		{
+			Chunk* chunk = get_or_create_chunk(state, { x, y });
+			if (!chunk)
+			{
+				printf(__FILE__ " :: Failed to create chunks.\n");
+				return false;
+			}
+
+			if (xorshift32(&seed) % 2)
+			{
+				if (!add_tree(state, chunk, { x, y }, 0))
+				{
+					printf(__FILE__ " :: Failed to add trees.\n");
+					return false;
+				}
+				tree_count += 1;
+			}
+		}
+	}
+
+	vi2 centers[QUERY_COUNT];
+	FOR_ELEMS(it, centers)
+	{
+		*it = { static_cast<i32>(xorshift32(&seed) % WORLD_DIM) - WORLD_DIM / 2, static_cast<i32>(xorshift32(&seed) % WORLD_DIM) - WORLD_DIM / 2 };
+	}
+
+	MemoryArena* arena = &state->arena;
+
+	lambda report =
+		[&](const char* name, f64 seconds, i64 entity_count, i32 query_count)
+		{
+			printf(":: %-24s : %8.1f ns/query, %6.1f entities/query\n", name, seconds * 1'000'000'000.0 / query_count, static_cast<f64>(entity_count) / query_count);
+		};
+
+	printf(":: %d entities over %dx%d chunks\n", tree_count, WORLD_CHUNK_DIM, WORLD_CHUNK_DIM);
+
+	{
+		i64 entity_count  = 0;
+		f64 seconds_start = query_seconds();
+		FOR_ELEMS(it, centers)
+		{
+			DEFER_ARENA_RESET(arena);
+			entity_count += query_rect(arena, state, *it - vx2(RECT_DIM / 2), *it + vx2(RECT_DIM / 2)).count;
+		}
+		report("rect, collected", query_seconds() - seconds_start, entity_count, QUERY_COUNT);
+	}
+
+	{
+		i64 entity_count  = 0;
+		f64 seconds_start = query_seconds();
+		FOR_ELEMS(it, centers)
+		{
+			RectQuery query = begin_rect_query(state, *it - vx2(RECT_DIM / 2), *it + vx2(RECT_DIM / 2));
+			EntityRef entity;
+			while (next(&entity, 0, &query))
+			{
+				entity_count += 1;
+			}
+		}
+		report("rect, iterated", query_seconds() - seconds_start, entity_count, QUERY_COUNT);
+	}
+
+	{
+		i64 entity_count  = 0;
+		f64 seconds_start = query_seconds();
+		FOR_ELEMS(it, centers)
+		{
+			entity_count += count_occupied_tiles(state, *it - vx2(RECT_DIM / 2), *it + vx2(RECT_DIM / 2));
+		}
+		report("rect, bitmap count", query_seconds() - seconds_start, entity_count, QUERY_COUNT);
+	}
+
+	i64 radius_entity_count = 0;
+	{
+		f64 seconds_start = query_seconds();
+		FOR_ELEMS(it, centers)
+		{
+			DEFER_ARENA_RESET(arena);
+			radius_entity_count += query_radius(arena, state, *it, RADIUS).count;
+		}
+		report("radius, collected", query_seconds() - seconds_start, radius_entity_count, QUERY_COUNT);
+	}
+
+	{
+		i64 entity_count  = 0;
+		f64 seconds_start = query_seconds();
+		FOR_ELEMS(it, centers)
+		{
+			RectQuery query = begin_radius_query(state, *it, RADIUS);
+			EntityRef entity;
+			while (next(&entity, 0, &query))
+			{
+				entity_count += 1;
+			}
+		}
+		report("radius, iterated", query_seconds() - seconds_start, entity_count, QUERY_COUNT);
+	}
+
+	{
+		i64 entity_count  = 0;
+		f64 seconds_start = query_seconds();
+		FOR_ELEMS(it, centers)
+		{
+			DEFER_ARENA_RESET(arena);
+			entity_count += query_line(arena, state, *it, *it + vi2 { LINE_LENGTH, LINE_LENGTH / 3 }).count;
+		}
+		report("line, collected", query_seconds() - seconds_start, entity_count, QUERY_COUNT);
+	}
+
+	// @NOTE@ What a hand-rolled loop over every chunk would cost, for comparison; only a fraction of the queries to keep it short.
+	{
+		constexpr i32 BRUTE_FORCE_QUERY_COUNT = QUERY_COUNT / 100;
+
+		i64 entity_count     = 0;
+		i64 sub_entity_count = 0;
+		f64 seconds_start    = query_seconds();
+		FOR_ELEMS(it, centers, BRUTE_FORCE_QUERY_COUNT)
+		{
+			FOR_ELEMS(slot, state->chunk_map.slots, state->chunk_map.capacity)
+			{
+				if (!slot->distance)
+				{
+					continue;
+				}
+
+				FOR_RANGE(y, CHUNK_DIM)
+				{
+					FOR_RANGE(x, CHUNK_DIM)
+					{
+						vi2 coords = slot->value->coords + vi2 { x, y };
+						if (type_of(slot->value->tiles[y][x]) != EntityType::null && square(coords.x - it->x) + square(coords.y - it->y) <= square(RADIUS))
+						{
+							entity_count += 1;
+						}
+					}
+				}
+			}
+		}
+		report("radius, every chunk", query_seconds() - seconds_start, entity_count, BRUTE_FORCE_QUERY_COUNT);
+
+		FOR_ELEMS(it, centers, BRUTE_FORCE_QUERY_COUNT)
+		{
+			DEFER_ARENA_RESET(arena);
+			sub_entity_count += query_radius(arena, state, *it, RADIUS).count;
+		}
+
+		if (entity_count != sub_entity_count)
+		{
+			printf(__FILE__ " :: Radius query found `%d` entities where every chunk had `%d`.\n", static_cast<i32>(sub_entity_count), static_cast<i32>(entity_count));
+			return false;
+		}
+	}
+
+	return true;
+}
+
+#pragma clang diagnostic pop
@@ -0,0 +1,144 @@
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wunused-function"
+
+// @NOTE@ Needs the work queue; region files go into `EXE_DIR`.
+procedure bool32 bench_streaming(void)
+{
+	constexpr i32 WORLD_REGION_DIM  = 16;
+	constexpr i32 WORLD_DIM         = WORLD_REGION_DIM * REGION_DIM;
+	constexpr i32 CAMERA_SPEED      = 16; // @NOTE@ Tiles per frame.
+	constexpr f64 SECONDS_PER_FRAME = 1.0 / 60.0;
+	constexpr i32 SETTLE_FRAME_MAX  = 600;
+
+	State* state = allocate_bench_state(MEBIBYTES_OF(256));
+	DEFER { free_bench_state(state); };
+	if (!state)
+	{
+		printf(__FILE__ " :: Failed to allocate memory.\n");
+		return false;
+	}
+	state->streaming.radius = STREAMING_DEFAULT_RADIUS;
+
+	u32 seed = 0xC0FFEE;
+	FOR_RANGE(chunk_iy, -WORLD_DIM / CHUNK_DIM / 2, WORLD_DIM / CHUNK_DIM / 2)
+	{
+		FOR_RANGE(chunk_ix, -WORLD_DIM / CHUNK_DIM / 2, WORLD_DIM / CHUNK_DIM / 2)
+		{
+			Chunk* chunk = get_or_create_chunk(state, vi2 { chunk_ix, chunk_iy } * CHUNK_DIM);
+			if (!chunk)
+			{
+				printf(__FILE__ " :: Failed to create chunks.\n");
+				return false;
+			}
+
+			i32 tree_count = static_cast<i32>(CHUNK_GENERATED_TREE_MAX / 2 + xorshift32(&seed) % (CHUNK_GENERATED_TREE_MAX / 2));
+			FOR_RANGE(tree_count)
+			{
+				vi2 coords;
+				do
+				{
+					coords = chunk->coords + vi2 { static_cast<i32>(xorshift32(&seed) % CHUNK_DIM), static_cast<i32>(xorshift32(&seed) % CHUNK_DIM) };
+				}
+				while (type_of(chunk->tiles[rel_coords_of(coords).y][rel_coords_of(coords).x]) != EntityType::null);
+
+				if (!add_tree(state, chunk, coords, static_cast<i32>(xorshift32(&seed) % 3)))
+				{
+					printf(__FILE__ " :: Failed to add trees.\n");
+					return false;
+				}
+			}
+		}
+	}
+
+	// @NOTE@ Order-independent, since chunks come back wherever the free list puts them.
+	lambda checksum_trees =
+		[&]()
+		{
+			u64 checksum = 0;
+			FOR_ELEMS(slot, state->chunk_map.slots, state->chunk_map.capacity)
+			{
+				if (slot->distance)
+				{
+					FOR_ELEMS(it, slot->value->trees, slot->value->tree_count)
+					{
+						EntityHandle tile = slot->value->tiles[rel_coords_of(it->coords).y][rel_coords_of(it->coords).x];
+						if (tile.bits == handle_of(EntityType::Tree, static_cast<u32>(it_index)).bits)
+						{
+							checksum += hash_coords(it->coords) ^ static_cast<u64>(it->bmp_index);
+						}
+					}
+				}
+			}
+			return checksum;
+		};
+
+	u64 checksum_before       = checksum_trees();
+	i32 resident_chunks_start = static_cast<i32>(state->chunk_map.count);
+	i32 resident_chunks_far   = 0;
+	i32 frame_count           = 0;
+	f64 seconds_total         = 0.0;
+	f64 seconds_worst         = 0.0;
+
+	// @NOTE@ Paced like a host would, otherwise the worker threads might not get a look in on a machine with few cores.
+	lambda step =
+		[&](vi2 focus)
+		{
+			state->hero.coords      = focus;
+			state->camera_coords    = focus;
+			state->last_found_chunk = 0;
+
+			f64 seconds_start = query_seconds();
+			update_streaming(state, PlatformReadFileData, PlatformFreeFileData, PlatformWriteFile, PlatformPushWork);
+			f64 seconds = query_seconds() - seconds_start;
+
+			seconds_total += seconds;
+			seconds_worst  = max(seconds_worst, seconds);
+			frame_count   += 1;
+
+			if (seconds < SECONDS_PER_FRAME)
+			{
+				timespec duration = { .tv_nsec = static_cast<long>((SECONDS_PER_FRAME - seconds) * 1'000'000'000.0) };
+				nanosleep(&duration, 0);
+			}
+		};
+
+	for (i32 x = 0; x <= WORLD_DIM; x += CAMERA_SPEED)
+	{
+		step({ x, 0 });
+	}
+	resident_chunks_far = static_cast<i32>(state->chunk_map.count);
+	for (i32 x = WORLD_DIM; x >= 0; x -= CAMERA_SPEED)
+	{
+		step({ x, 0 });
+	}
+
+	i32 resident_chunks_back = static_cast<i32>(state->chunk_map.count);
+
+	aliasing stats = state->streaming.stats;
+	printf(":: %d frames flying %d tiles out and back over %dx%d regions of %dx%d chunks\n", frame_count, WORLD_DIM, WORLD_REGION_DIM, WORLD_REGION_DIM, REGION_DIM_IN_CHUNKS, REGION_DIM_IN_CHUNKS);
+	printf(":: update_streaming : %8.1f us/frame on average, %8.1f us at worst\n", seconds_total * 1'000'000.0 / max(frame_count, 1), seconds_worst * 1'000'000.0);
+	printf(":: resident chunks  : %d at the start, %d at the farthest, %d after coming back (%.1f KiB resident, %.1f KiB of arena used)\n", resident_chunks_start, resident_chunks_far, resident_chunks_back, static_cast<f64>(stats.resident_chunk_bytes) / 1024.0, static_cast<f64>(stats.arena_used) / 1024.0);
+	printf(":: regions          : %d resident, %d stored\n", stats.resident_region_count, stats.stored_region_count);
+	printf(":: streamed         : %d stores (%.1f KiB), %d loads (%.1f KiB), %d failures\n", stats.store_count, static_cast<f64>(stats.bytes_written) / 1024.0, stats.load_count, static_cast<f64>(stats.bytes_read) / 1024.0, stats.failure_count);
+
+	// @NOTE@ Widening the radius over the whole world brings every region back, so every tree can be accounted for.
+	state->streaming.radius = WORLD_DIM;
+	FOR_RANGE(SETTLE_FRAME_MAX)
+	{
+		if (stats.stored_region_count == 0 && stats.resident_region_count == square(WORLD_REGION_DIM))
+		{
+			break;
+		}
+		step({ 0, 0 });
+	}
+
+	if (stats.failure_count || stats.stored_region_count || checksum_trees() != checksum_before)
+	{
+		printf(__FILE__ " :: Trees differ after streaming the whole world back in.\n");
+		return false;
+	}
+
+	return true;
+}
+
+#pragma clang diagnostic pop
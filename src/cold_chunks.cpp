@@ -0,0 +1,228 @@
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wunused-function"
+
+// @NOTE@ Chunks out of the way of the hero and the camera that haven't changed in `COLD_CHUNK_TICKS` updates are packed down to their trees, a tile index and a BMP index
+// in `PACKED_TREE_BITS` each, and freed. Everything else a chunk has (summary, bitmaps, tiles) follows from its trees, so `find_or_thaw_chunk` unpacks a cold chunk back
+// into exactly what it was. `find_chunk` never does, so just looking at the world never changes it; cold chunks are only ever away from the hero and the camera anyway.
+// Chunks with creatures or tile features stay warm, same as they keep their region resident.
+
+static_assert(CHUNK_DIM * CHUNK_DIM <= (1 << 8), "A tile index has to fit in the low 8 bits of a packed tree.");
+static_assert(sizeof(State::bmp.trees) / sizeof(BMP) <= (1 << (PACKED_TREE_BITS - 8)), "A tree's BMP index has to fit in the rest of a packed tree.");
+static_assert(PACKED_TREE_BITS + 7 <= 24, "A packed tree is read and written three bytes at a time.");
+
+procedure i64 warm_bytes_of(i32 tree_count)
+{
+	return static_cast<i64>(sizeof(Chunk)) + tree_list_capacity_of(tree_count) * static_cast<i64>(sizeof(Tree)) + static_cast<i64>(sizeof(CoordsMapSlot<Chunk>));
+}
+
+procedure void pack_chunk(PackedChunk* packed, Chunk* chunk)
+{
+	ASSERT(chunk->tree_count <= COLD_CHUNK_TREE_MAX);
+	*packed = { .coords = chunk->coords, .tree_count = chunk->tree_count };
+
+	FOR_ELEMS(it, chunk->trees, chunk->tree_count)
+	{
+		vi2 rel_coords = rel_coords_of(it->coords);
+		i32 bit_index  = static_cast<i32>(it_index) * PACKED_TREE_BITS;
+		u32 code       = static_cast<u32>(rel_coords.y * CHUNK_DIM + rel_coords.x) | (static_cast<u32>(it->bmp_index) << 8);
+
+		// @NOTE@ Bytes past the last tree's bits are never written to, since nothing's shifted into them.
+		for (u32 rest = code << (bit_index % 8), byte_index = static_cast<u32>(bit_index / 8); rest; rest >>= 8, byte_index += 1)
+		{
+			packed->bits[byte_index] |= static_cast<u8>(rest);
+		}
+	}
+}
+
+procedure void unpack_trees(Tree* trees, PackedChunk* packed)
+{
+	FOR_ELEMS(it, trees, packed->tree_count)
+	{
+		i32 bit_index = static_cast<i32>(it_index) * PACKED_TREE_BITS;
+		u32 window    = 0;
+		FOR_RANGE(i, 3)
+		{
+			if (bit_index / 8 + i < static_cast<i32>(sizeof(packed->bits)))
+			{
+				window |= static_cast<u32>(packed->bits[bit_index / 8 + i]) << (8 * i);
+			}
+		}
+		u32 code = (window >> (bit_index % 8)) & ((1U << PACKED_TREE_BITS) - 1);
+
+		it->coords    = packed->coords + vi2 { static_cast<i32>(code & 0xFF) % CHUNK_DIM, static_cast<i32>(code & 0xFF) / CHUNK_DIM };
+		it->bmp_index = static_cast<i32>(code >> 8);
+	}
+}
+
+// @NOTE@ The summary the chunk would have warm, since it has nothing but trees.
+procedure void summarize_cold_chunk(ChunkSummary* summary, PackedChunk* packed)
+{
+	Tree trees[COLD_CHUNK_TREE_MAX];
+	unpack_trees(trees, packed);
+
+	*summary = { .tree_count = static_cast<u16>(packed->tree_count) };
+	FOR_ELEMS(it, &summary->thumbnail[0][0], CHUNK_DIM * CHUNK_DIM)
+	{
+		*it = summary_rgba_of({}, 0);
+	}
+	FOR_ELEMS(it, trees, packed->tree_count)
+	{
+		vi2 rel_coords = rel_coords_of(it->coords);
+		summary->thumbnail[rel_coords.y][rel_coords.x] = summary_rgba_of(EntityType::Tree, 0);
+	}
+}
+
+procedure void release_cold_chunk(State* state, ColdChunk* cold_chunk)
+{
+	aliasing cold_chunks = state->cold_chunks;
+	unlink_changed_chunk(&cold_chunks.changed_chunks, cold_chunk);
+	cold_chunks.warm_bytes           -= warm_bytes_of(cold_chunk->packed.tree_count);
+	cold_chunk->next_free_cold_chunk  = cold_chunks.free_cold_chunks;
+	cold_chunks.free_cold_chunks      = cold_chunk;
+}
+
+// @NOTE@ For a cold chunk whose region's being evicted, which has no need of being thawed first.
+procedure void discard_cold_chunk(State* state, ColdChunk* cold_chunk)
+{
+	ColdChunk* erased = erase(&state->cold_chunks.chunks, cold_chunk->packed.coords);
+	ASSERT(erased == cold_chunk);
+	release_cold_chunk(state, cold_chunk);
+}
+
+procedure bool32 is_freezable(State* state, Chunk* chunk)
+{
+	return
+		state->cold_chunks.tick - chunk->touched_tick >= COLD_CHUNK_TICKS &&
+		!chunk->features                                                  &&
+		!chunk->summary.creature_count                                    &&
+		chunk->tree_count <= COLD_CHUNK_TREE_MAX;
+}
+
+// @NOTE@ False (with the chunk left as it was) if there's no room for the cold chunk.
+procedure bool32 freeze_chunk(State* state, Chunk* chunk)
+{
+	ASSERT(is_freezable(state, chunk));
+	aliasing cold_chunks = state->cold_chunks;
+
+	ColdChunk* cold_chunk = cold_chunks.free_cold_chunks;
+	if (cold_chunk)
+	{
+		cold_chunks.free_cold_chunks = cold_chunk->next_free_cold_chunk;
+	}
+	else
+	{
+		cold_chunk = allocate<ColdChunk>(&state->arena);
+		if (!cold_chunk)
+		{
+			return false;
+		}
+	}
+
+	*cold_chunk = { .change_generation = chunk->change_generation };
+	pack_chunk(&cold_chunk->packed, chunk);
+	if (!insert(&cold_chunks.chunks, &state->arena, chunk->coords, cold_chunk))
+	{
+		cold_chunk->next_free_cold_chunk = cold_chunks.free_cold_chunks;
+		cold_chunks.free_cold_chunks     = cold_chunk;
+		return false;
+	}
+
+	relink_changed_chunk(state, &cold_chunks.changed_chunks, cold_chunk);
+	cold_chunks.warm_bytes           += warm_bytes_of(chunk->tree_count);
+	cold_chunks.stats.compress_count += 1;
+	delete_chunk(state, chunk);
+	return true;
+}
+
+// @NOTE@ Null (with the chunk left cold) if there's no room for the chunk. The chunk comes back as it was, down to its change generation, without being marked changed;
+// its region's resident, since a cold chunk is thrown away along with its region.
+procedure Chunk* thaw_chunk(State* state, ColdChunk* cold_chunk)
+{
+	aliasing cold_chunks = state->cold_chunks;
+
+	Tree trees[COLD_CHUNK_TREE_MAX];
+	unpack_trees(trees, &cold_chunk->packed);
+
+	Chunk* chunk = create_chunk(state, cold_chunk->packed.coords);
+	if (!chunk)
+	{
+		return 0;
+	}
+	FOR_ELEMS(it, trees, cold_chunk->packed.tree_count)
+	{
+		if (!place_tree(state, chunk, it->coords, it->bmp_index))
+		{
+			delete_chunk(state, chunk);
+			return 0;
+		}
+	}
+
+	chunk->change_generation = cold_chunk->change_generation;
+	chunk->touched_tick      = cold_chunks.tick;
+	relink_changed_chunk(state, &state->changed_chunks, chunk);
+
+	ColdChunk* erased = erase(&cold_chunks.chunks, cold_chunk->packed.coords);
+	ASSERT(erased == cold_chunk);
+	cold_chunks.stats.decompress_count += 1;
+	release_cold_chunk(state, cold_chunk);
+	return chunk;
+}
+
+procedure void update_cold_chunks(State* state)
+{
+	aliasing cold_chunks = state->cold_chunks;
+	cold_chunks.tick += 1;
+
+	//
+	// Touch chunks in range.
+	//
+
+	// @NOTE@ Any that are cold get thawed ahead of time, the same way chunks get generated ahead of time.
+	vi2 foci[] = { state->hero.coords, state->camera_coords };
+	FOR_ELEMS(focus, foci)
+	{
+		vi2 min_chunk_coords = chunk_coords_of(*focus - vx2(COLD_CHUNK_RADIUS));
+		vi2 max_chunk_coords = chunk_coords_of(*focus + vx2(COLD_CHUNK_RADIUS));
+		FOR_RANGE(chunk_iy, min_chunk_coords.y / CHUNK_DIM, max_chunk_coords.y / CHUNK_DIM + 1)
+		{
+			FOR_RANGE(chunk_ix, min_chunk_coords.x / CHUNK_DIM, max_chunk_coords.x / CHUNK_DIM + 1)
+			{
+				Chunk* chunk = find_or_thaw_chunk(state, vi2 { chunk_ix, chunk_iy } * CHUNK_DIM);
+				if (chunk)
+				{
+					chunk->touched_tick = cold_chunks.tick;
+				}
+			}
+		}
+	}
+
+	//
+	// Compress chunks gone untouched.
+	//
+
+	// @NOTE@ Only a slice of the chunk map's looked over each update, picking up where the last update left off.
+	FOR_RANGE(min(static_cast<i64>(COLD_CHUNK_SWEEP_SLOTS), state->chunk_map.capacity))
+	{
+		if (cold_chunks.sweep_index >= state->chunk_map.capacity)
+		{
+			cold_chunks.sweep_index = 0;
+		}
+
+		CoordsMapSlot<Chunk>* slot = &state->chunk_map.slots[cold_chunks.sweep_index];
+		if (slot->distance && is_freezable(state, slot->value) && freeze_chunk(state, slot->value))
+		{
+			continue; // @NOTE@ Backward-shift deletion may have moved another chunk into the slot.
+		}
+		cold_chunks.sweep_index += 1;
+	}
+
+	//
+	// Stats.
+	//
+
+	cold_chunks.stats.cold_chunk_count = static_cast<i32>(cold_chunks.chunks.count);
+	cold_chunks.stats.cold_chunk_bytes = cold_chunks.chunks.count * static_cast<i64>(sizeof(ColdChunk)) + cold_chunks.chunks.capacity * static_cast<i64>(sizeof(CoordsMapSlot<ColdChunk>));
+	cold_chunks.stats.saved_bytes      = cold_chunks.warm_bytes - cold_chunks.stats.cold_chunk_bytes;
+}
+
+#pragma clang diagnostic pop
@@ -0,0 +1,182 @@
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wunused-function"
+
+// @NOTE@ Open-addressing map from coordinates to pointers with Robin Hood probing and backward-shift deletion.
+// Slots come out of an arena and double once the map is 7/8ths full; the outgrown slots are left behind in the arena until it's next reset.
+// Erasing leaves no tombstones, so a map only grows past the most entries it's ever held, and what it leaves behind adds up to less than its live slots.
+// Maps that churn, like the chunk map under streaming, should be reserved to their steady-state size up front so that cost is never paid at all.
+
+template <typename TYPE>
+struct CoordsMapSlot
+{
+	vi2             coords;
+	i32             distance; // @NOTE@ Probe distance plus one; zero marks an empty slot.
+	OffsetPtr<TYPE> value;
+};
+
+template <typename TYPE>
+struct CoordsMap
+{
+	i64                            capacity; // @NOTE@ Zero or a power of two.
+	i64                            count;
+	OffsetPtr<CoordsMapSlot<TYPE>> slots;
+};
+
+typedef CoordsMap<Chunk> ChunkMap;
+
+constexpr i64 COORDS_MAP_INITIAL_CAPACITY = 64;
+
+// @NOTE@ SplitMix64 finalizer over both coordinates packed together.
+procedure u64 hash_coords(vi2 coords)
+{
+	u64 hash = (static_cast<u64>(static_cast<u32>(coords.x)) << 32) | static_cast<u32>(coords.y);
+	hash ^= hash >> 30;
+	hash *= 0xBF58476D1CE4E5B9;
+	hash ^= hash >> 27;
+	hash *= 0x94D049BB133111EB;
+	hash ^= hash >> 31;
+	return hash;
+}
+
+template <typename TYPE>
+procedure CoordsMapSlot<TYPE>* find_slot(CoordsMap<TYPE>* map, vi2 coords)
+{
+	if (!map->capacity)
+	{
+		return 0;
+	}
+
+	i64 index = static_cast<i64>(hash_coords(coords) & static_cast<u64>(map->capacity - 1));
+	for (i32 distance = 1;; distance += 1)
+	{
+		CoordsMapSlot<TYPE>* slot = &map->slots[index];
+
+		// @NOTE@ Anything we're looking for would've displaced a slot closer to its home than we are to ours.
+		if (slot->distance < distance)
+		{
+			return 0;
+		}
+		if (slot->coords == coords)
+		{
+			return slot;
+		}
+
+		index = (index + 1) & (map->capacity - 1);
+	}
+}
+
+template <typename TYPE>
+procedure TYPE* find(CoordsMap<TYPE>* map, vi2 coords)
+{
+	CoordsMapSlot<TYPE>* slot = find_slot(map, coords);
+	return slot ? slot->value : 0;
+}
+
+template <typename TYPE>
+procedure void place(CoordsMap<TYPE>* map, vi2 coords, TYPE* value)
+{
+	CoordsMapSlot<TYPE> entry = { .coords = coords, .distance = 1, .value = value };
+	i64                 index = static_cast<i64>(hash_coords(coords) & static_cast<u64>(map->capacity - 1));
+	while (true)
+	{
+		aliasing slot = map->slots[index];
+		if (!slot.distance)
+		{
+			slot = entry;
+			return;
+		}
+		if (slot.distance < entry.distance)
+		{
+			CoordsMapSlot<TYPE> displaced = slot;
+			slot  = entry;
+			entry = displaced;
+		}
+
+		entry.distance += 1;
+		index           = (index + 1) & (map->capacity - 1);
+	}
+}
+
+// @NOTE@ Grows the map ahead of time so `count` entries fit without it having to grow again.
+template <typename TYPE>
+procedure bool32 reserve(CoordsMap<TYPE>* map, MemoryArena* arena, i64 count)
+{
+	if (count * 8 <= map->capacity * 7)
+	{
+		return true;
+	}
+
+	CoordsMap<TYPE> grown =
+		{
+			.capacity = map->capacity ? map->capacity * 2 : COORDS_MAP_INITIAL_CAPACITY,
+			.count    = map->count,
+		};
+	while (count * 8 > grown.capacity * 7)
+	{
+		grown.capacity *= 2;
+	}
+	grown.slots = allocate<CoordsMapSlot<TYPE>>(arena, grown.capacity);
+	if (!grown.slots)
+	{
+		return false;
+	}
+	memset(grown.slots, 0, static_cast<u64>(grown.capacity) * sizeof(CoordsMapSlot<TYPE>));
+
+	// @NOTE@ `FOR_ELEMS` can't name the type of a dependent count.
+	for (i64 i = 0; i < map->capacity; i += 1)
+	{
+		if (map->slots[i].distance)
+		{
+			place(&grown, map->slots[i].coords, static_cast<TYPE*>(map->slots[i].value));
+		}
+	}
+
+	*map = grown;
+	return true;
+}
+
+template <typename TYPE>
+procedure bool32 insert(CoordsMap<TYPE>* map, MemoryArena* arena, vi2 coords, TYPE* value)
+{
+	ASSERT(!find_slot(map, coords));
+
+	if (!reserve(map, arena, map->count + 1))
+	{
+		return false;
+	}
+
+	place(map, coords, value);
+	map->count += 1;
+	return true;
+}
+
+template <typename TYPE>
+procedure TYPE* erase(CoordsMap<TYPE>* map, vi2 coords)
+{
+	CoordsMapSlot<TYPE>* slot = find_slot(map, coords);
+	if (!slot)
+	{
+		return 0;
+	}
+
+	TYPE* value = slot->value;
+	i64   index = slot - map->slots;
+	while (true)
+	{
+		aliasing next = map->slots[(index + 1) & (map->capacity - 1)];
+		if (next.distance <= 1)
+		{
+			map->slots[index] = {};
+			break;
+		}
+
+		map->slots[index]           = next;
+		map->slots[index].distance -= 1;
+		index                       = (index + 1) & (map->capacity - 1);
+	}
+
+	map->count -= 1;
+	return value;
+}
+
+#pragma clang diagnostic pop
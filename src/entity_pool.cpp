@@ -0,0 +1,136 @@
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wunused-function"
+
+// @NOTE@ A fixed-capacity pool that keeps its elements dense (so updating all of them is one pass over an array) while still handing out stable indices.
+// An index is a slot and the slot's generation packed into `ENTITY_HANDLE_INDEX_BITS`; slots point at wherever their element currently is in the dense
+// array, and despawning swap-removes the element and bumps its slot's generation. A handle that outlives its element, like one left behind on a tile,
+// no longer matches its slot's generation and resolves to nothing. Generations wrap after `1 << (ENTITY_HANDLE_INDEX_BITS - SLOT_BITS)` reuses of a slot.
+// Fields that are better off apart from the rest of each element go in `HOT`, a struct of arrays of a four-byte lane per element, which is moved and cleared
+// along with `elems` lane by lane without needing to know what the fields are. All zeros is an empty pool.
+
+struct EntityPoolSlot
+{
+	u32 generation;
+	i32 index;      // @NOTE@ Into the dense elements while the slot's in use; the next free slot plus one while it's free.
+};
+
+template <typename TYPE, typename HOT, i32 SLOT_BITS>
+struct EntityPool
+{
+	static_assert(IN_RANGE(SLOT_BITS, 1, ENTITY_HANDLE_INDEX_BITS));
+	static_assert(sizeof(HOT) % (sizeof(u32) << SLOT_BITS) == 0, "Every field of `HOT` is an array of four-byte lanes, one per element.");
+
+	static constexpr i32 HOT_LANE_COUNT = static_cast<i32>(sizeof(HOT) / (sizeof(u32) << SLOT_BITS));
+
+	i32            count;
+	i32            slot_count;                  // @NOTE@ Slots ever handed out; every slot past this is free and has never been used.
+	i32            free_slot;                   // @NOTE@ The first free slot plus one, or zero if there are none below `slot_count`.
+	TYPE           elems     [1 << SLOT_BITS];  // @NOTE@ Only the first `count` are in use.
+	u32            elem_slots[1 << SLOT_BITS];  // @NOTE@ The slot of each element in use.
+	EntityPoolSlot slots     [1 << SLOT_BITS];
+	HOT            hot;                         // @NOTE@ Indexed like `elems`.
+};
+
+// @NOTE@ The `lane`th field of `HOT`, as raw lanes.
+template <typename TYPE, typename HOT, i32 SLOT_BITS>
+procedure u32* hot_lanes_of(EntityPool<TYPE, HOT, SLOT_BITS>* pool, i32 lane)
+{
+	ASSERT(IN_RANGE(lane, 0, pool->HOT_LANE_COUNT));
+	return reinterpret_cast<u32*>(&pool->hot) + (static_cast<i64>(lane) << SLOT_BITS);
+}
+
+template <typename TYPE, typename HOT, i32 SLOT_BITS>
+procedure u32 pool_index_of(EntityPool<TYPE, HOT, SLOT_BITS>* pool, u32 slot)
+{
+	return (slot | (pool->slots[slot].generation << SLOT_BITS)) & ENTITY_HANDLE_INDEX_MASK;
+}
+
+template <typename TYPE, typename HOT, i32 SLOT_BITS>
+procedure u32 pool_index_of(EntityPool<TYPE, HOT, SLOT_BITS>* pool, TYPE* elem)
+{
+	ASSERT(IN_RANGE(elem - pool->elems, 0, pool->count));
+	return pool_index_of(pool, pool->elem_slots[elem - pool->elems]);
+}
+
+// @NOTE@ Null if the element's been despawned. Only good until the next despawn, which may move the element.
+template <typename TYPE, typename HOT, i32 SLOT_BITS>
+procedure TYPE* find(EntityPool<TYPE, HOT, SLOT_BITS>* pool, u32 index)
+{
+	u32 slot = index & ((1U << SLOT_BITS) - 1);
+	if (slot >= static_cast<u32>(pool->slot_count) || pool_index_of(pool, slot) != index)
+	{
+		return 0;
+	}
+	return &pool->elems[pool->slots[slot].index];
+}
+
+// @NOTE@ Zero-initialized and contiguous, and all or nothing; null if there isn't room for `count` more.
+// Writes the new elements' indices out to `indices` if it's given.
+template <typename TYPE, typename HOT, i32 SLOT_BITS>
+procedure TYPE* spawn(EntityPool<TYPE, HOT, SLOT_BITS>* pool, i32 count, u32* indices = 0)
+{
+	if (count > capacityof(pool->elems) - pool->count)
+	{
+		return 0;
+	}
+
+	TYPE* elems = &pool->elems[pool->count];
+	FOR_ELEMS(it, elems, count)
+	{
+		u32 slot;
+		if (pool->free_slot)
+		{
+			slot            = static_cast<u32>(pool->free_slot - 1);
+			pool->free_slot = pool->slots[slot].index;
+		}
+		else
+		{
+			slot              = static_cast<u32>(pool->slot_count);
+			pool->slot_count += 1;
+		}
+
+		*it                            = {};
+		pool->slots[slot].index        = pool->count;
+		pool->elem_slots[pool->count]  = slot;
+		// @NOTE@ `FOR_RANGE` can't name the type of a dependent count.
+		for (i32 lane = 0; lane < pool->HOT_LANE_COUNT; lane += 1)
+		{
+			hot_lanes_of(pool, lane)[pool->count] = 0;
+		}
+		pool->count                   += 1;
+		if (indices)
+		{
+			indices[it_index] = pool_index_of(pool, slot);
+		}
+	}
+
+	return elems;
+}
+
+// @NOTE@ Moves the last element into the despawned one's place.
+template <typename TYPE, typename HOT, i32 SLOT_BITS>
+procedure void despawn(EntityPool<TYPE, HOT, SLOT_BITS>* pool, u32 index)
+{
+	TYPE* elem = find(pool, index);
+	ASSERT(elem);
+
+	i32 elem_index = static_cast<i32>(elem - pool->elems);
+	u32 slot       = pool->elem_slots[elem_index];
+	pool->count -= 1;
+	if (elem_index != pool->count)
+	{
+		pool->elems     [elem_index]                         = pool->elems     [pool->count];
+		pool->elem_slots[elem_index]                         = pool->elem_slots[pool->count];
+		pool->slots     [pool->elem_slots[elem_index]].index = elem_index;
+		for (i32 lane = 0; lane < pool->HOT_LANE_COUNT; lane += 1)
+		{
+			hot_lanes_of(pool, lane)[elem_index] = hot_lanes_of(pool, lane)[pool->count];
+		}
+	}
+
+	pool->slots[slot].generation += 1;
+	pool->slots[slot].index       = pool->free_slot;
+	pool->free_slot               = static_cast<i32>(slot) + 1;
+}
+
+#pragma clang diagnostic pop
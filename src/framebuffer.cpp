@@ -0,0 +1,52 @@
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wunused-function"
+#include <emmintrin.h>
+
+// @NOTE@ Host-side helpers for presenting what the game rendered into a host's native framebuffer.
+
+procedure bool32 is_game_renderable(const PlatformFramebuffer& framebuffer)
+{
+	return framebuffer.format == PLATFORM_GAME_PIXEL_FORMAT && framebuffer.stride == framebuffer.dims.x;
+}
+
+// @NOTE@ Swapping the R and B channels goes both ways between `bgra` and `rgba`.
+procedure void swizzle_rb(u32* dst, const u32* src, i32 count)
+{
+	i32 index = 0;
+
+	const __m128i MASK_AG = _mm_set1_epi32(static_cast<i32>(0xFF00FF00));
+	const __m128i MASK_RB = _mm_set1_epi32(static_cast<i32>(0x00FF00FF));
+	for (; index + 4 <= count; index += 4)
+	{
+		__m128i pixels = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + index));
+		__m128i ag     = _mm_and_si128(pixels, MASK_AG);
+		__m128i rb     = _mm_and_si128(pixels, MASK_RB);
+		_mm_storeu_si128(reinterpret_cast<__m128i*>(dst + index), _mm_or_si128(ag, _mm_or_si128(_mm_slli_epi32(rb, 16), _mm_srli_epi32(rb, 16))));
+	}
+
+	for (; index < count; index += 1)
+	{
+		dst[index] = (src[index] & 0xFF00FF00) | ((src[index] & 0x00FF0000) >> 16) | ((src[index] & 0x000000FF) << 16);
+	}
+}
+
+procedure void blit_framebuffer(PlatformFramebuffer* dst, const PlatformFramebuffer* src)
+{
+	ASSERT(dst->dims == src->dims);
+
+	FOR_RANGE(y, dst->dims.y)
+	{
+		u32*       dst_row = dst->pixels + static_cast<i64>(y) * dst->stride;
+		const u32* src_row = src->pixels + static_cast<i64>(y) * src->stride;
+		if (dst->format == src->format)
+		{
+			memcpy(dst_row, src_row, static_cast<size_t>(dst->dims.x) * sizeof(u32));
+		}
+		else
+		{
+			swizzle_rb(dst_row, src_row, dst->dims.x);
+		}
+	}
+}
+
+#pragma clang diagnostic pop
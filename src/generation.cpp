@@ -0,0 +1,185 @@
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wunused-function"
+
+// @NOTE@ A chunk's contents come from nothing but its coordinates, so it doesn't matter which thread generates it, or when, or in what order.
+// Chunks near the hero and the camera get queued onto the worker threads ahead of time; a chunk that's needed before then (e.g. walked into)
+// gets generated on the spot by `get_or_generate_chunk`. Either way, a chunk only enters the chunk map once it's been filled in.
+
+procedure i32 generate_chunk_trees(Tree* trees, vi2 chunk_coords)
+{
+	ASSERT(chunk_coords_of(chunk_coords) == chunk_coords);
+
+	TileBitmap taken = {};
+	FOR_RANGE(y, max(chunk_coords.y, 0), min(chunk_coords.y + CHUNK_DIM, SPAWN_CLEARING_DIMS.y))
+	{
+		FOR_RANGE(x, max(chunk_coords.x, 0), min(chunk_coords.x + CHUNK_DIM, SPAWN_CLEARING_DIMS.x))
+		{
+			set(&taken, rel_coords_of({ x, y }), true);
+		}
+	}
+
+	// @NOTE@ Picks among the free tiles directly rather than rerolling until one's free.
+	u32 seed       = static_cast<u32>(hash_coords(chunk_coords));
+	i32 tree_count = min(rng(&seed, CHUNK_GENERATED_TREE_MAX / 2, CHUNK_GENERATED_TREE_MAX), CHUNK_DIM * CHUNK_DIM - count_set_tiles(&taken));
+	FOR_ELEMS(it, trees, tree_count)
+	{
+		vi2 rel_coords = nth_clear_tile(&taken, rng(&seed, CHUNK_DIM * CHUNK_DIM - count_set_tiles(&taken)));
+		set(&taken, rel_coords, true);
+
+		it->coords    = chunk_coords + rel_coords;
+		it->bmp_index = static_cast<i32>(rng(&seed, sizeof(State::bmp.trees) / sizeof(BMP)));
+	}
+
+	return tree_count;
+}
+
+procedure void fill_chunk(State* state, Chunk* chunk, Tree* trees, i32 tree_count)
+{
+	ASSERT(!chunk->tree_count);
+	FOR_ELEMS(it, trees, tree_count)
+	{
+		Tree* tree = add_tree(state, chunk, it->coords, it->bmp_index);
+		ASSERT(tree);
+	}
+}
+
+// @NOTE@ Null if the chunk's region isn't resident, same as `get_or_create_chunk`.
+procedure Chunk* get_or_generate_chunk(State* state, vi2 coords)
+{
+	Chunk* chunk = find_or_thaw_chunk(state, coords);
+	if (!chunk)
+	{
+		chunk = get_or_create_chunk(state, coords);
+		if (chunk)
+		{
+			Tree trees[CHUNK_GENERATED_TREE_MAX];
+			fill_chunk(state, chunk, trees, generate_chunk_trees(trees, chunk->coords));
+			state->generation.stats.first_access_count += 1;
+		}
+	}
+	return chunk;
+}
+
+procedure PlatformWork_t(generate_chunk_work)
+{
+	GenerationJob* job = reinterpret_cast<GenerationJob*>(platform_work_data);
+	if (claim_job(job))
+	{
+		job->tree_count = generate_chunk_trees(job->trees, job->chunk_coords);
+		__atomic_store_n(&job->done, true, __ATOMIC_RELEASE);
+	}
+}
+
+// @NOTE@ Takes back every queued job without filling anything in, waiting out any that a worker's in the middle of.
+procedure void cancel_generation_jobs(State* state)
+{
+	FOR_ELEMS(job, state->generation.jobs)
+	{
+		if (job->in_use)
+		{
+			job->in_use = false;
+			claim_job_or_wait(job);
+		}
+	}
+}
+
+procedure void update_generation(State* state, PlatformPushWork_t* PlatformPushWork)
+{
+	aliasing generation = state->generation;
+
+	//
+	// Resolve the jobs queued last update.
+	//
+
+	FOR_ELEMS(job, generation.jobs)
+	{
+		if (!job->in_use)
+		{
+			continue;
+		}
+		job->in_use = false;
+
+		if (claim_job_or_wait(job))
+		{
+			job->tree_count = generate_chunk_trees(job->trees, job->chunk_coords);
+			generation.stats.main_thread_count += 1;
+		}
+		else
+		{
+			generation.stats.worker_count += 1;
+		}
+
+		Chunk* chunk = find_chunk(state, job->chunk_coords) || find(&state->cold_chunks.chunks, job->chunk_coords) ? 0 : get_or_create_chunk(state, job->chunk_coords);
+		if (chunk)
+		{
+			fill_chunk(state, chunk, job->trees, job->tree_count);
+		}
+		else
+		{
+			generation.stats.discarded_count += 1;
+		}
+	}
+
+	//
+	// Queue chunks coming into range.
+	//
+
+	vi2 foci[] = { state->hero.coords, state->camera_coords };
+	FOR_ELEMS(focus, foci)
+	{
+		vi2 min_chunk_coords = chunk_coords_of(*focus - vx2(GENERATION_RADIUS));
+		vi2 max_chunk_coords = chunk_coords_of(*focus + vx2(GENERATION_RADIUS));
+		FOR_RANGE(chunk_iy, min_chunk_coords.y / CHUNK_DIM, max_chunk_coords.y / CHUNK_DIM + 1)
+		{
+			FOR_RANGE(chunk_ix, min_chunk_coords.x / CHUNK_DIM, max_chunk_coords.x / CHUNK_DIM + 1)
+			{
+				vi2 chunk_coords = vi2 { chunk_ix, chunk_iy } * CHUNK_DIM;
+				// @NOTE@ Cold chunks were generated long ago too; they're thawed by `update_cold_chunks` on their way into range.
+				if (find_chunk(state, chunk_coords) || find(&state->cold_chunks.chunks, chunk_coords))
+				{
+					continue;
+				}
+
+				// @NOTE@ Chunks of evicted regions are already on disk.
+				Region* region = find(&state->streaming.regions, region_coords_of(chunk_coords));
+				if (region && region->status != RegionStatus::resident)
+				{
+					continue;
+				}
+
+				GenerationJob* free_job    = 0;
+				bool32         is_queued   = false;
+				FOR_ELEMS(job, generation.jobs)
+				{
+					if (job->in_use)
+					{
+						is_queued |= job->chunk_coords == chunk_coords;
+					}
+					else if (!free_job)
+					{
+						free_job = job;
+					}
+				}
+				if (is_queued)
+				{
+					continue;
+				}
+				if (!free_job)
+				{
+					goto QUEUED;
+				}
+
+				free_job->in_use       = true;
+				free_job->chunk_coords = chunk_coords;
+				if (!push_job(PlatformPushWork, generate_chunk_work, free_job))
+				{
+					// @NOTE@ Resolved on the main thread next update instead.
+					goto QUEUED;
+				}
+			}
+		}
+	}
+	QUEUED:;
+}
+
+#pragma clang diagnostic pop
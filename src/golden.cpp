@@ -0,0 +1,173 @@
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wunused-function"
+
+// @NOTE@ Scenes played from scratch by the headless host with scripted input, whose final frames are compared against bitmaps kept from an earlier run.
+
+// @NOTE@ Each character of `script` is the letter pressed on that frame, `.` for no input; frames past the script get no input.
+struct GoldenScene
+{
+	String name;
+	i32    frame_count;
+	String script;
+};
+
+constexpr GoldenScene GOLDEN_SCENES[] =
+	{
+		{ String("idle"     ), 24, String(""              ) },
+		{ String("walk"     ), 24, String("d..w..w..a..s.") },
+		{ String("plate"    ), 72, String("d.w.w.w"       ) }, // @NOTE@ Hero steps onto the pressure plate and the monstar comes for them.
+		{ String("camera"   ), 24, String("l.l.k.k"       ) },
+		{ String("world_map"),  4, String("m"             ) },
+		{ String("overdraw" ),  4, String("o"             ) },
+	};
+
+struct GoldenComparison
+{
+	bool32 loaded;
+	i32    mismatch_count;
+	i32    max_channel_delta;
+};
+
+// @NOTE@ Only understands bitmaps made by `write_framebuffer_bmp`. The `bgra` diff image dims what matched and marks what didn't in red.
+procedure GoldenComparison compare_with_golden_bmp(PlatformFramebuffer* diff_framebuffer, String golden_file_path, PlatformFramebuffer* framebuffer, i32 tolerance)
+{
+	ASSERT(diff_framebuffer->dims   == framebuffer->dims);
+	ASSERT(diff_framebuffer->stride == diff_framebuffer->dims.x);
+	ASSERT(diff_framebuffer->format == PlatformPixelFormat::bgra);
+
+	PlatformFileData file_data = PlatformReadFileData(golden_file_path);
+	if (!file_data.data)
+	{
+		return {};
+	}
+	DEFER { PlatformFreeFileData(&file_data); };
+
+	BitmapInfoHeader header;
+	if (file_data.size < sizeof(BitmapInfoHeader))
+	{
+		return {};
+	}
+	memcpy(&header, file_data.data, sizeof(BitmapInfoHeader));
+
+	if
+	(
+		(header.name[0] != 'B' || header.name[1] != 'M')                           ||
+		(header.file_size != file_data.size)                                       ||
+		(header.pixel_data_offset != sizeof(BitmapInfoHeader))                     ||
+		(header.dims != vi2 { framebuffer->dims.x, -framebuffer->dims.y })         ||
+		(header.bits_per_pixel != 32)                                              ||
+		(header.compression_method != 0)                                           ||
+		(header.pixel_data_size != static_cast<u32>(framebuffer->dims.x * framebuffer->dims.y) * sizeof(u32))
+	)
+	{
+		return {};
+	}
+
+	GoldenComparison comparison = { .loaded = true };
+
+	blit_framebuffer(diff_framebuffer, framebuffer);
+
+	const u32* golden_pixels = reinterpret_cast<const u32*>(file_data.data + header.pixel_data_offset);
+	FOR_RANGE(i, framebuffer->dims.x * framebuffer->dims.y)
+	{
+		aliasing pixel = diff_framebuffer->pixels[i];
+
+		i32 pixel_delta = 0;
+		FOR_RANGE(channel_index, 3)
+		{
+			i32 shift   = static_cast<i32>(channel_index) * 8;
+			pixel_delta = max(pixel_delta, abs(static_cast<i32>((pixel >> shift) & 0xFF) - static_cast<i32>((golden_pixels[i] >> shift) & 0xFF)));
+		}
+
+		comparison.max_channel_delta = max(comparison.max_channel_delta, pixel_delta);
+		if (pixel_delta > tolerance)
+		{
+			comparison.mismatch_count += 1;
+			pixel = 0xFFFF0000;
+		}
+		else
+		{
+			pixel = (pixel >> 2) & 0x003F3F3F;
+		}
+	}
+
+	return comparison;
+}
+
+// @NOTE@ `run` plays a scene from scratch the way `main` would any other, and leaves its final frame as the last one presented.
+// False if a scene couldn't be run or a golden frame couldn't be written, as well as if any scene didn't match.
+template <typename RUN>
+procedure bool32 run_golden_scenes(RUN run, String golden_dir, bool32 update_golden, i32 tolerance)
+{
+	u32* diff_pixels = reinterpret_cast<u32*>(calloc(static_cast<size_t>(FRAMEBUFFER_DIMS.x * FRAMEBUFFER_DIMS.y), sizeof(u32)));
+	DEFER { free(diff_pixels); };
+	if (!diff_pixels)
+	{
+		printf(__FILE__ " :: Failed to allocate memory.\n");
+		return false;
+	}
+
+	PlatformFramebuffer diff_framebuffer =
+		{
+			.dims   = FRAMEBUFFER_DIMS,
+			.stride = FRAMEBUFFER_DIMS.x,
+			.format = PlatformPixelFormat::bgra,
+			.pixels = diff_pixels
+		};
+
+	i32 failure_count = 0;
+	FOR_ELEMS(scene, GOLDEN_SCENES)
+	{
+		if (!run(scene->frame_count, scene->script, UPDATES_PER_SECOND) || !g_present_ring.last_presented_slot)
+		{
+			return false;
+		}
+		PlatformFramebuffer* framebuffer = &g_present_ring.last_presented_slot->host_framebuffer;
+
+		char golden_file_path[256];
+		char diff_file_path  [256];
+		i32  golden_file_path_size = snprintf(golden_file_path, sizeof(golden_file_path), "%.*s/%.*s.bmp"     , PASS_ISTR(golden_dir), PASS_ISTR(scene->name));
+		i32  diff_file_path_size   = snprintf(diff_file_path  , sizeof(diff_file_path  ), "%.*s/%.*s.diff.bmp", PASS_ISTR(golden_dir), PASS_ISTR(scene->name));
+		if (!IN_RANGE(golden_file_path_size, 0, static_cast<i32>(sizeof(golden_file_path))) || !IN_RANGE(diff_file_path_size, 0, static_cast<i32>(sizeof(diff_file_path))))
+		{
+			printf(__FILE__ " :: Golden directory `%.*s` is too long.\n", PASS_ISTR(golden_dir));
+			return false;
+		}
+
+		if (update_golden)
+		{
+			if (!write_framebuffer_bmp({ golden_file_path_size, golden_file_path }, framebuffer))
+			{
+				printf(__FILE__ " :: Failed to write golden frame `%s`.\n", golden_file_path);
+				return false;
+			}
+			printf(":: Updated `%s`.\n", golden_file_path);
+		}
+		else
+		{
+			GoldenComparison comparison = compare_with_golden_bmp(&diff_framebuffer, { golden_file_path_size, golden_file_path }, framebuffer, tolerance);
+			if (!comparison.loaded)
+			{
+				failure_count += 1;
+				printf(":: FAIL %-10.*s : Missing or unrecognized golden frame `%s`.\n", PASS_ISTR(scene->name), golden_file_path);
+			}
+			else if (comparison.mismatch_count)
+			{
+				failure_count += 1;
+				printf(":: FAIL %-10.*s : %d pixels differ (largest channel delta of %d); see `%s`.\n", PASS_ISTR(scene->name), comparison.mismatch_count, comparison.max_channel_delta, diff_file_path);
+				if (!write_framebuffer_bmp({ diff_file_path_size, diff_file_path }, &diff_framebuffer))
+				{
+					printf(__FILE__ " :: Failed to write diff frame `%s`.\n", diff_file_path);
+				}
+			}
+			else
+			{
+				printf(":: PASS %-10.*s : Largest channel delta of %d.\n", PASS_ISTR(scene->name), comparison.max_channel_delta);
+			}
+		}
+	}
+
+	return !failure_count;
+}
+
+#pragma clang diagnostic pop
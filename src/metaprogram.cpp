@@ -1621,6 +1621,58 @@ int main()
 					append(meta_builder, String("#pragma clang diagnostic pop\n"));
 				}
 
+				appendf(meta_builder, "\n");
+
+				i32 type_count = 1;
+				FOR_NODES(members)
+				{
+					type_count += 1;
+				}
+
+				{
+					appendf(meta_builder, "template <typename TYPE, i32 CAPACITY>\nstruct %.*sKinds\n{\n\ti32  counts[%d];\n", PASS_ISTR(file_name), type_count);
+					FOR_NODES(members)
+					{
+						appendf(meta_builder, "\tTYPE %.*s_[CAPACITY];\n", PASS_ISTR(it->str));
+					}
+					appendf(meta_builder, "};\n");
+
+					appendf(meta_builder, "\n");
+
+					appendf(meta_builder, "template <typename TYPE, i32 CAPACITY>\nprocedure TYPE* elems_of(%.*sKinds<TYPE, CAPACITY>* kinds, %.*sType type)\n{\n\tswitch (type)\n\t{\n", PASS_ISTR(file_name), PASS_ISTR(file_name));
+					appendf(meta_builder, "\t\tcase %.*sType::null: return 0;\n", PASS_ISTR(file_name));
+					FOR_NODES(members)
+					{
+						appendf(meta_builder, "\t\tcase %.*sType::%.*s: return kinds->%.*s_;\n", PASS_ISTR(file_name), PASS_ISTR(it->str), PASS_ISTR(it->str));
+					}
+					appendf(meta_builder, "\t}\n}\n");
+
+					appendf(meta_builder, "\n");
+
+					FOR_NODES(members)
+					{
+						appendf(meta_builder, "#define FOR_%.*s_%.*s(NAME, KINDS) FOR_ELEMS(NAME, (KINDS)->%.*s_, (KINDS)->counts[static_cast<i32>(%.*sType::%.*s)])\n", PASS_ISTR(file_name), PASS_ISTR(it->str), PASS_ISTR(it->str), PASS_ISTR(file_name), PASS_ISTR(it->str));
+					}
+
+					appendf(meta_builder, "\n");
+
+					appendf(meta_builder, "template <typename TYPE, typename DATA>\nstruct %.*sBatches\n{\n", PASS_ISTR(file_name));
+					FOR_NODES(members)
+					{
+						appendf(meta_builder, "\tvoid (*%.*s_)(TYPE* xs, i32 count, DATA* data);\n", PASS_ISTR(it->str));
+					}
+					appendf(meta_builder, "};\n");
+
+					appendf(meta_builder, "\n");
+
+					appendf(meta_builder, "template <typename TYPE, i32 CAPACITY, typename DATA>\nprocedure void dispatch(%.*sKinds<TYPE, CAPACITY>* kinds, const %.*sBatches<TYPE, DATA>& batches, DATA* data)\n{\n", PASS_ISTR(file_name), PASS_ISTR(file_name));
+					FOR_NODES(members)
+					{
+						appendf(meta_builder, "\tif (batches.%.*s_ && kinds->counts[static_cast<i32>(%.*sType::%.*s)]) { batches.%.*s_(kinds->%.*s_, kinds->counts[static_cast<i32>(%.*sType::%.*s)], data); }\n", PASS_ISTR(it->str), PASS_ISTR(file_name), PASS_ISTR(it->str), PASS_ISTR(it->str), PASS_ISTR(it->str), PASS_ISTR(file_name), PASS_ISTR(it->str));
+					}
+					appendf(meta_builder, "}\n");
+				}
+
 				String meta_data = flush(meta_builder);
 				append(meta_builder, String(SRC_DIR));
 				append(meta_builder, file_path);
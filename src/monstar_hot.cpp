@@ -0,0 +1,107 @@
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wunused-function"
+#include <emmintrin.h>
+
+// @NOTE@ What changes about a monstar every update, kept apart from the rest of `Monstar` in one array per field so the update streams through just these,
+// four monstars to an SSE register. The periods are really just the flags, but the vector loop can't afford to look at `Monstar` to find them out.
+
+enum struct MonstarUpdate : u32
+{
+	dormant,
+	alive,
+	dying
+};
+
+template <i32 CAPACITY>
+struct MonstarHot
+{
+	static_assert(CAPACITY % 4 == 0, "Monstars are updated four at a time.");
+
+	alignas(16) f32 rel_pos_x     [CAPACITY];
+	alignas(16) f32 rel_pos_y     [CAPACITY];
+	alignas(16) f32 rel_pos_z     [CAPACITY];
+	alignas(16) f32 prev_rel_pos_x[CAPACITY]; // @NOTE@ Like `Hero::prev_rel_pos`; only ever touched outside of the vector loop.
+	alignas(16) f32 prev_rel_pos_y[CAPACITY];
+	alignas(16) f32 prev_rel_pos_z[CAPACITY];
+	alignas(16) f32 hover_t       [CAPACITY];
+	alignas(16) f32 move_t        [CAPACITY];
+	alignas(16) f32 existence_t   [CAPACITY];
+	alignas(16) f32 hover_period  [CAPACITY]; // @NOTE@ Zero if it isn't flying.
+	alignas(16) f32 move_period   [CAPACITY];
+	alignas(16) u32 update        [CAPACITY]; // @NOTE@ A `MonstarUpdate`, set afresh before every update.
+};
+
+template <i32 CAPACITY>
+procedure vf3 rel_pos_of(MonstarHot<CAPACITY>* hot, i64 index)
+{
+	return { hot->rel_pos_x[index], hot->rel_pos_y[index], hot->rel_pos_z[index] };
+}
+
+template <i32 CAPACITY>
+procedure vf3 prev_rel_pos_of(MonstarHot<CAPACITY>* hot, i64 index)
+{
+	return { hot->prev_rel_pos_x[index], hot->prev_rel_pos_y[index], hot->prev_rel_pos_z[index] };
+}
+
+// @NOTE@ Everything about the update that doesn't depend on where a monstar is or what's around it. Does every monstar up to `count` rounded up to
+// a multiple of four, so the lanes past `count` have to be dormant. Does exactly the float operations `dampen` and the rest would one monstar at a time,
+// so it comes out bit for bit the same.
+template <i32 CAPACITY>
+procedure void integrate_monstars(MonstarHot<CAPACITY>* hot, i64 count, f32 delta_time)
+{
+	ASSERT(IN_RANGE(count, 0, CAPACITY + 1));
+
+	const __m128  ZERO        = _mm_setzero_ps();
+	const __m128  ONE         = _mm_set1_ps(1.0f);
+	const __m128  DELTA_TIME  = _mm_set1_ps(delta_time);
+	const __m128  XY_DAMPING  = _mm_set1_ps(dampen_factor(0.01f, delta_time));
+	const __m128  Z_DAMPING   = _mm_set1_ps(dampen_factor(0.1f , delta_time));
+	const __m128i ALIVE       = _mm_set1_epi32(static_cast<i32>(MonstarUpdate::alive));
+	const __m128i DYING       = _mm_set1_epi32(static_cast<i32>(MonstarUpdate::dying));
+
+	lambda select =
+		[](__m128 mask, __m128 a, __m128 b)
+		{
+			return _mm_or_ps(_mm_and_ps(mask, a), _mm_andnot_ps(mask, b));
+		};
+
+	for (i64 index = 0; index < count; index += 4)
+	{
+		__m128i update = _mm_load_si128(reinterpret_cast<__m128i*>(hot->update + index));
+		__m128  alive  = _mm_castsi128_ps(_mm_cmpeq_epi32(update, ALIVE));
+		__m128  dying  = _mm_castsi128_ps(_mm_cmpeq_epi32(update, DYING));
+
+		__m128 rel_pos_x    = _mm_load_ps(hot->rel_pos_x    + index);
+		__m128 rel_pos_y    = _mm_load_ps(hot->rel_pos_y    + index);
+		__m128 rel_pos_z    = _mm_load_ps(hot->rel_pos_z    + index);
+		__m128 hover_t      = _mm_load_ps(hot->hover_t      + index);
+		__m128 move_t       = _mm_load_ps(hot->move_t       + index);
+		__m128 existence_t  = _mm_load_ps(hot->existence_t  + index);
+		__m128 hover_period = _mm_load_ps(hot->hover_period + index);
+		__m128 move_period  = _mm_load_ps(hot->move_period  + index);
+
+		// @NOTE@ `dampen(rel_pos.xy, { 0.0f, 0.0f }, 0.01f, delta_time)`.
+		rel_pos_x = select(alive, _mm_add_ps(ZERO, _mm_mul_ps(_mm_sub_ps(rel_pos_x, ZERO), XY_DAMPING)), rel_pos_x);
+		rel_pos_y = select(alive, _mm_add_ps(ZERO, _mm_mul_ps(_mm_sub_ps(rel_pos_y, ZERO), XY_DAMPING)), rel_pos_y);
+
+		__m128 flying       = _mm_and_ps(alive, _mm_cmpneq_ps(hover_period, ZERO));
+		__m128 next_hover_t = _mm_add_ps(hover_t, _mm_div_ps(DELTA_TIME, hover_period));
+		next_hover_t = _mm_sub_ps(next_hover_t, _mm_and_ps(ONE, _mm_cmpge_ps(next_hover_t, ONE)));
+		hover_t      = select(flying, next_hover_t, hover_t);
+
+		move_t = select(alive, _mm_add_ps(move_t, _mm_div_ps(DELTA_TIME, move_period)), move_t);
+
+		// @NOTE@ `max(existence_t - delta_time, 0.0f)`, with the operands swapped so a tie comes out as `existence_t` like `max` has it.
+		existence_t = select(dying, _mm_max_ps(ZERO, _mm_sub_ps(existence_t, DELTA_TIME)), existence_t);
+		rel_pos_z   = select(dying, _mm_add_ps(ZERO, _mm_mul_ps(_mm_sub_ps(rel_pos_z, ZERO), Z_DAMPING)), rel_pos_z);
+
+		_mm_store_ps(hot->rel_pos_x   + index, rel_pos_x  );
+		_mm_store_ps(hot->rel_pos_y   + index, rel_pos_y  );
+		_mm_store_ps(hot->rel_pos_z   + index, rel_pos_z  );
+		_mm_store_ps(hot->hover_t     + index, hover_t    );
+		_mm_store_ps(hot->move_t      + index, move_t     );
+		_mm_store_ps(hot->existence_t + index, existence_t);
+	}
+}
+
+#pragma clang diagnostic pop
@@ -21,10 +21,21 @@
 global constexpr i32 PLATFORM_GAMEPAD_MAX = 4;
 global constexpr i64 PLATFORM_MEMORY_SIZE = GIBIBYTES_OF(1);
 
+enum struct PlatformPixelFormat : u8
+{
+	bgra, // @NOTE@ 0xAARRGGBB.
+	rgba  // @NOTE@ 0xAABBGGRR.
+};
+
+// @NOTE@ The game only ever renders in this format into a tightly packed framebuffer; hosts with a different native layout convert when presenting.
+global constexpr PlatformPixelFormat PLATFORM_GAME_PIXEL_FORMAT = PlatformPixelFormat::bgra;
+
 struct PlatformFramebuffer
 {
-	vi2  dims;
-	u32* pixels;
+	vi2                 dims;
+	i32                 stride; // @NOTE@ In pixels.
+	PlatformPixelFormat format;
+	u32*                pixels;
 };
 
 struct PlatformSample
@@ -123,9 +134,38 @@ typedef PlatformFreeFileData_t(PlatformFreeFileData_t);
 #define PlatformWriteFile_t(NAME) bool32 NAME(String platform_file_path, byte* platform_write_data, u64 platform_write_size)
 typedef PlatformWriteFile_t(PlatformWriteFile_t);
 
-#define PlatformUpdate_t(NAME) PlatformUpdateExitCode NAME(PlatformFramebuffer* platform_framebuffer, PlatformInput* platform_input, byte* platform_memory, f32 platform_delta_time, PlatformReadFileData_t PlatformReadFileData, PlatformFreeFileData_t PlatformFreeFileData, PlatformWriteFile_t PlatformWriteFile)
-typedef PlatformUpdate_t(PlatformUpdate_t);
-extern  PlatformUpdate_t(PlatformUpdate  );
+// @NOTE@ A read-only view of the whole file rather than a copy of it; pages only get read in as they're touched.
+#define PlatformMapFileData_t(NAME) PlatformFileData NAME(String platform_file_path)
+typedef PlatformMapFileData_t(PlatformMapFileData_t);
+
+#define PlatformUnmapFileData_t(NAME) void NAME(PlatformFileData* platform_file_data)
+typedef PlatformUnmapFileData_t(PlatformUnmapFileData_t);
+
+// @NOTE@ Runs on one of the host's worker threads, so it must only touch what the game has handed over to it.
+#define PlatformWork_t(NAME) void NAME(void* platform_work_data)
+typedef PlatformWork_t(PlatformWork_t);
+
+// @NOTE@ Queues work without waiting on it; false if the queue is full. Hosts finish all queued work before reloading the game or touching its memory.
+#define PlatformPushWork_t(NAME) bool32 NAME(PlatformWork_t* platform_work, void* platform_work_data)
+typedef PlatformPushWork_t(PlatformPushWork_t);
+
+// @NOTE@ Advances the game by exactly `platform_delta_time`, which hosts keep fixed; called as many times between renders as it takes to keep up with real time, including none.
+// The input's presses are consumed by the first call after they happen, so hosts clear them after every call rather than every render.
+#define PlatformSimulate_t(NAME) PlatformUpdateExitCode NAME(PlatformInput* platform_input, byte* platform_memory, f32 platform_delta_time, PlatformReadFileData_t PlatformReadFileData, PlatformFreeFileData_t PlatformFreeFileData, PlatformWriteFile_t PlatformWriteFile, PlatformMapFileData_t PlatformMapFileData, PlatformUnmapFileData_t PlatformUnmapFileData, PlatformPushWork_t PlatformPushWork)
+typedef PlatformSimulate_t(PlatformSimulate_t);
+extern  PlatformSimulate_t(PlatformSimulate  );
+
+// @NOTE@ Draws the game `platform_alpha` of the way from what the second-to-last simulate left to what the last one did, so one is exactly the latest state.
+// Only called once the game has been simulated at least once.
+#define PlatformRender_t(NAME) void NAME(PlatformFramebuffer* platform_framebuffer, byte* platform_memory, f32 platform_alpha)
+typedef PlatformRender_t(PlatformRender_t);
+extern  PlatformRender_t(PlatformRender  );
+
+// @NOTE@ Finishes whatever the game has going on in the background and lets go of anything it's holding of the host's, so the platform memory can be copied, restored, or moved as is.
+// Hosts call this right before doing any of those, on the same thread they simulate on.
+#define PlatformSettle_t(NAME) void NAME(byte* platform_memory, PlatformFreeFileData_t PlatformFreeFileData)
+typedef PlatformSettle_t(PlatformSettle_t);
+extern  PlatformSettle_t(PlatformSettle  );
 
 #define PlatformSound_t(NAME) void NAME(PlatformSample* platform_sample_buffer, u64 platform_sample_count, i32 platform_samples_per_second, byte* platform_memory)
 typedef PlatformSound_t(PlatformSound_t);
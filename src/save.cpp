@@ -0,0 +1,677 @@
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wunused-function"
+
+// @NOTE@ A save is a header indexing a handful of sections, each an array of plain structs that are copied into `State` as they are.
+// The file is memory-mapped and read in place; the only fix-ups are the pointers `State` keeps (tree lists, tile features, the chunk and region maps),
+// since tiles refer to entities by handle rather than by pointer. Regions out on disk are saved along with everything else, so a save stands on its own.
+
+constexpr u32 SAVE_FILE_MAGIC        = 0x444C5257; // @NOTE@ "WRLD".
+constexpr u32 SAVE_FILE_VERSION      = 5;          // @NOTE@ Bumped whenever any of the saved structs, or `Chunk` from `summary` on, changes.
+constexpr u64 SAVE_SECTION_ALIGNMENT = 16;         // @NOTE@ Enough for any saved struct, given the file's mapped page-aligned.
+
+struct SaveSection
+{
+	u64 offset;       // @NOTE@ From the start of the file.
+	u64 count;
+	u64 element_size; // @NOTE@ Checked against the loader's own, so a struct that's changed shape is caught even if the version wasn't bumped.
+};
+
+struct SaveFileHeader
+{
+	u32 magic;
+	u32 version;
+	u64 size;
+
+	union
+	{
+		struct
+		{
+			SaveSection globals;
+			SaveSection regions;
+			SaveSection chunks;
+			SaveSection trees;
+			SaveSection tile_features;
+			SaveSection cold_chunks;
+			SaveSection monstars;
+			SaveSection monstar_elem_slots;
+			SaveSection monstar_hot_lanes;  // @NOTE@ Each of `MonstarPool::hot`'s fields in turn, one lane per monstar.
+			SaveSection monstar_slots;
+			SaveSection region_file_bytes;
+		}           section;
+		SaveSection sections[sizeof(section) / sizeof(SaveSection)];
+	};
+};
+
+struct SavedGlobals
+{
+	u32           seed;
+	i32           streaming_radius;
+	f64           sim_time;
+	Hero          hero;
+	Pet           pet;
+	i32           monstar_free_slot; // @NOTE@ The rest of `State::monstars` has its own sections, as much of each array as is in use.
+	PressurePlate pressure_plate;
+	vi2           camera_coords;
+	vf2           camera_rel_pos;
+};
+
+// @NOTE@ Everything of `Chunk` from `summary` on is plain data, handles included, so it's copied in and out in one go.
+struct SavedChunk
+{
+	vi2  coords;
+	i32  first_tree;         // @NOTE@ Into the trees section.
+	i32  tree_count;
+	i32  first_tile_feature; // @NOTE@ Into the tile features section, in list order.
+	i32  tile_feature_count;
+	byte tail[sizeof(Chunk) - offsetof(Chunk, summary)];
+};
+
+struct SavedTileFeature
+{
+	vi2    coords;
+	bool32 has_pressure_plate; // @NOTE@ There's only the one, `State::pressure_plate`.
+};
+
+// @NOTE@ A stored region comes with its region file as it was on disk.
+struct SavedRegion
+{
+	vi2          coords;
+	RegionStatus status;
+	u64          file_offset; // @NOTE@ Into the region file bytes section.
+	u64          file_size;
+};
+
+// @NOTE@ Ordered as the header's sections are.
+global constexpr u64 SAVE_ELEMENT_SIZES[] =
+	{
+		sizeof(SavedGlobals),
+		sizeof(SavedRegion),
+		sizeof(SavedChunk),
+		sizeof(Tree),
+		sizeof(SavedTileFeature),
+		sizeof(PackedChunk),
+		sizeof(Monstar),
+		sizeof(u32),
+		sizeof(u32),
+		sizeof(EntityPoolSlot),
+		sizeof(byte),
+	};
+static_assert(sizeof(SAVE_ELEMENT_SIZES) / sizeof(u64) == sizeof(SaveFileHeader::sections) / sizeof(SaveSection));
+
+// @NOTE@ Waits on the regions in flight first, so every region is either resident or has a region file to save along with it.
+procedure bool32 save_world(State* state, MemoryArena* arena, String file_path, PlatformReadFileData_t* PlatformReadFileData, PlatformFreeFileData_t* PlatformFreeFileData, PlatformWriteFile_t* PlatformWriteFile)
+{
+	DEFER_ARENA_RESET(arena);
+	finish_streaming_jobs(state, PlatformFreeFileData, true);
+
+	//
+	// Read stored regions back in.
+	//
+
+	i64 stored_region_count = 0;
+	FOR_ELEMS(slot, state->streaming.regions.slots, state->streaming.regions.capacity)
+	{
+		stored_region_count += slot->distance && slot->value->status == RegionStatus::stored;
+	}
+
+	struct RegionFile
+	{
+		vi2              coords;
+		PlatformFileData file_data;
+	};
+	RegionFile* region_files      = allocate<RegionFile>(arena, stored_region_count);
+	i64         region_file_count = 0;
+	DEFER
+	{
+		FOR_ELEMS(it, region_files, region_file_count)
+		{
+			PlatformFreeFileData(&it->file_data);
+		}
+	};
+	if (stored_region_count && !region_files)
+	{
+		return false;
+	}
+
+	u64 region_file_bytes = 0;
+	FOR_ELEMS(slot, state->streaming.regions.slots, state->streaming.regions.capacity)
+	{
+		if (slot->distance && slot->value->status == RegionStatus::stored)
+		{
+			char   file_path_buffer[sizeof(StreamingJob::file_path_buffer)];
+			String region_file_path = region_file_path_of(&file_path_buffer, slot->value->coords);
+
+			PlatformFileData file_data = PlatformReadFileData(region_file_path);
+			if (!file_data.data)
+			{
+				DEBUG_printf(__FILE__ " :: Couldn't read region file `%.*s` to save it.\n", PASS_ISTR(region_file_path));
+				return false;
+			}
+
+			region_files[region_file_count]  = { .coords = slot->value->coords, .file_data = file_data };
+			region_file_count               += 1;
+			region_file_bytes               += file_data.size;
+		}
+	}
+
+	//
+	// Lay out sections.
+	//
+
+	i64 tree_count         = 0;
+	i64 tile_feature_count = 0;
+	FOR_ELEMS(slot, state->chunk_map.slots, state->chunk_map.capacity)
+	{
+		if (slot->distance)
+		{
+			tree_count += slot->value->tree_count;
+			FOR_NODES(feature, slot->value->features)
+			{
+				tile_feature_count += 1;
+			}
+		}
+	}
+
+	SaveFileHeader header =
+		{
+			.magic   = SAVE_FILE_MAGIC,
+			.version = SAVE_FILE_VERSION,
+			.size    = sizeof(SaveFileHeader),
+		};
+	u64 section_counts[] =
+		{
+			1,
+			static_cast<u64>(state->streaming.regions.count),
+			static_cast<u64>(state->chunk_map.count),
+			static_cast<u64>(tree_count),
+			static_cast<u64>(tile_feature_count),
+			static_cast<u64>(state->cold_chunks.chunks.count),
+			static_cast<u64>(state->monstars.count),
+			static_cast<u64>(state->monstars.count),
+			static_cast<u64>(state->monstars.HOT_LANE_COUNT) * static_cast<u64>(state->monstars.count),
+			static_cast<u64>(state->monstars.slot_count),
+			region_file_bytes,
+		};
+	static_assert(sizeof(section_counts) == sizeof(SAVE_ELEMENT_SIZES));
+	FOR_ELEMS(section, header.sections)
+	{
+		header.size = (header.size + SAVE_SECTION_ALIGNMENT - 1) & ~(SAVE_SECTION_ALIGNMENT - 1);
+		*section    =
+			{
+				.offset       = header.size,
+				.count        = section_counts[section_index],
+				.element_size = SAVE_ELEMENT_SIZES[section_index],
+			};
+		header.size += section->count * section->element_size;
+	}
+
+	byte* data = allocate<byte>(arena, static_cast<i64>(header.size));
+	if (!data)
+	{
+		return false;
+	}
+	memset(data, 0, header.size);
+	memcpy(data, &header, sizeof(SaveFileHeader));
+
+	lambda write_element =
+		[&](SaveSection* section, i64 index, void* element)
+		{
+			ASSERT(IN_RANGE(index, 0, static_cast<i64>(section->count)));
+			memcpy(data + section->offset + static_cast<u64>(index) * section->element_size, element, section->element_size);
+		};
+
+	//
+	// Copy everything in.
+	//
+
+	SavedGlobals globals =
+		{
+			.seed              = state->seed,
+			.streaming_radius  = state->streaming.radius,
+			.sim_time          = state->sim_time,
+			.hero              = state->hero,
+			.pet               = state->pet,
+			.monstar_free_slot = state->monstars.free_slot,
+			.pressure_plate    = state->pressure_plate,
+			.camera_coords     = state->camera_coords,
+			.camera_rel_pos    = state->camera_rel_pos,
+		};
+	write_element(&header.section.globals, 0, &globals);
+
+	// @NOTE@ Stored regions come up in the same order they were read in.
+	i64 region_index       = 0;
+	i64 region_file_index  = 0;
+	u64 region_file_offset = 0;
+	FOR_ELEMS(slot, state->streaming.regions.slots, state->streaming.regions.capacity)
+	{
+		if (!slot->distance)
+		{
+			continue;
+		}
+
+		SavedRegion saved_region = { .coords = slot->value->coords, .status = slot->value->status };
+		if (slot->value->status == RegionStatus::stored)
+		{
+			RegionFile* region_file = &region_files[region_file_index];
+			ASSERT(region_file->coords == slot->value->coords);
+			saved_region.file_offset = region_file_offset;
+			saved_region.file_size   = region_file->file_data.size;
+			memcpy(data + header.section.region_file_bytes.offset + region_file_offset, region_file->file_data.data, region_file->file_data.size);
+			region_file_index  += 1;
+			region_file_offset += region_file->file_data.size;
+		}
+		else
+		{
+			ASSERT(slot->value->status == RegionStatus::resident);
+		}
+
+		write_element(&header.section.regions, region_index, &saved_region);
+		region_index += 1;
+	}
+
+	i64 chunk_index        = 0;
+	i64 tree_index         = 0;
+	i64 tile_feature_index = 0;
+	FOR_ELEMS(slot, state->chunk_map.slots, state->chunk_map.capacity)
+	{
+		if (!slot->distance)
+		{
+			continue;
+		}
+		Chunk* chunk = slot->value;
+
+		SavedChunk saved_chunk =
+			{
+				.coords             = chunk->coords,
+				.first_tree         = static_cast<i32>(tree_index),
+				.tree_count         = chunk->tree_count,
+				.first_tile_feature = static_cast<i32>(tile_feature_index),
+			};
+		memcpy(saved_chunk.tail, reinterpret_cast<byte*>(chunk) + offsetof(Chunk, summary), sizeof(saved_chunk.tail));
+
+		FOR_ELEMS(it, chunk->trees, chunk->tree_count)
+		{
+			write_element(&header.section.trees, tree_index, it);
+			tree_index += 1;
+		}
+
+		FOR_NODES(feature, chunk->features)
+		{
+			ASSERT(!feature->pressure_plate || feature->pressure_plate == &state->pressure_plate);
+			SavedTileFeature saved_tile_feature = { .coords = feature->coords, .has_pressure_plate = feature->pressure_plate != 0 };
+			write_element(&header.section.tile_features, tile_feature_index, &saved_tile_feature);
+			tile_feature_index             += 1;
+			saved_chunk.tile_feature_count += 1;
+		}
+
+		write_element(&header.section.chunks, chunk_index, &saved_chunk);
+		chunk_index += 1;
+	}
+
+	// @NOTE@ Cold chunks are saved as they're packed, without being thawed.
+	i64 cold_chunk_index = 0;
+	FOR_ELEMS(slot, state->cold_chunks.chunks.slots, state->cold_chunks.chunks.capacity)
+	{
+		if (slot->distance)
+		{
+			write_element(&header.section.cold_chunks, cold_chunk_index, &slot->value->packed);
+			cold_chunk_index += 1;
+		}
+	}
+
+	FOR_ELEMS(it, state->monstars.elems, state->monstars.count)
+	{
+		write_element(&header.section.monstars          , it_index, it                                   );
+		write_element(&header.section.monstar_elem_slots, it_index, &state->monstars.elem_slots[it_index]);
+	}
+	FOR_RANGE(lane, state->monstars.HOT_LANE_COUNT)
+	{
+		FOR_RANGE(i, state->monstars.count)
+		{
+			write_element(&header.section.monstar_hot_lanes, lane * state->monstars.count + i, &hot_lanes_of(&state->monstars, lane)[i]);
+		}
+	}
+	FOR_ELEMS(it, state->monstars.slots, state->monstars.slot_count)
+	{
+		write_element(&header.section.monstar_slots, it_index, it);
+	}
+
+	if (!PlatformWriteFile(file_path, data, header.size))
+	{
+		return false;
+	}
+
+	return true;
+}
+
+// @NOTE@ Throws away the current world and replaces it with the save's; false (with the current world untouched) if the save doesn't hold up.
+// Only the layout is checked (offsets, counts, and sizes), not the contents of each chunk; that's the same trust a region file gets.
+procedure bool32 load_world(State* state, String file_path, PlatformMapFileData_t* PlatformMapFileData, PlatformUnmapFileData_t* PlatformUnmapFileData, PlatformFreeFileData_t* PlatformFreeFileData, PlatformWriteFile_t* PlatformWriteFile)
+{
+	PlatformFileData file_data = PlatformMapFileData(file_path);
+	if (!file_data.data)
+	{
+		return false;
+	}
+	DEFER { PlatformUnmapFileData(&file_data); };
+
+	//
+	// Validate.
+	//
+
+	SaveFileHeader header;
+	if (file_data.size < sizeof(SaveFileHeader))
+	{
+		return false;
+	}
+	memcpy(&header, file_data.data, sizeof(SaveFileHeader));
+
+	if
+	(
+		(header.magic != SAVE_FILE_MAGIC)     ||
+		(header.version != SAVE_FILE_VERSION) ||
+		(header.size != file_data.size)
+	)
+	{
+		return false;
+	}
+
+	FOR_ELEMS(section, header.sections)
+	{
+		if
+		(
+			(section->element_size != SAVE_ELEMENT_SIZES[section_index])                  ||
+			(section->offset % SAVE_SECTION_ALIGNMENT)                                    ||
+			(!IN_RANGE(section->offset, sizeof(SaveFileHeader), header.size + 1))         ||
+			(section->count > (header.size - section->offset) / section->element_size)
+		)
+		{
+			return false;
+		}
+	}
+
+	// @NOTE@ Sections are read in place, which the mapping's page alignment and the sections' own alignment make safe.
+	SavedGlobals*     globals            = reinterpret_cast<SavedGlobals    *>(file_data.data + header.section.globals           .offset);
+	SavedRegion*      regions            = reinterpret_cast<SavedRegion     *>(file_data.data + header.section.regions           .offset);
+	SavedChunk*       chunks             = reinterpret_cast<SavedChunk      *>(file_data.data + header.section.chunks            .offset);
+	Tree*             trees              = reinterpret_cast<Tree            *>(file_data.data + header.section.trees             .offset);
+	SavedTileFeature* tile_features      = reinterpret_cast<SavedTileFeature*>(file_data.data + header.section.tile_features     .offset);
+	PackedChunk*      cold_chunks        = reinterpret_cast<PackedChunk     *>(file_data.data + header.section.cold_chunks       .offset);
+	Monstar*          monstars           = reinterpret_cast<Monstar         *>(file_data.data + header.section.monstars          .offset);
+	u32*              monstar_elem_slots = reinterpret_cast<u32             *>(file_data.data + header.section.monstar_elem_slots.offset);
+	u32*              monstar_hot_lanes  = reinterpret_cast<u32             *>(file_data.data + header.section.monstar_hot_lanes .offset);
+	EntityPoolSlot*   monstar_slots      = reinterpret_cast<EntityPoolSlot  *>(file_data.data + header.section.monstar_slots     .offset);
+	byte*             region_file_bytes  =                                     file_data.data + header.section.region_file_bytes .offset;
+	i64               region_count       = static_cast<i64>(header.section.regions      .count);
+	i64               chunk_count        = static_cast<i64>(header.section.chunks       .count);
+	i64               cold_chunk_count   = static_cast<i64>(header.section.cold_chunks  .count);
+	i64               monstar_count      = static_cast<i64>(header.section.monstars     .count);
+	i64               monstar_slot_count = static_cast<i64>(header.section.monstar_slots.count);
+	i64               chunk_map_count    = max(chunk_count, static_cast<i64>(STREAMING_RESIDENT_CHUNK_COUNT)); // @NOTE@ Same as the game starts out with, so streaming doesn't grow it right after.
+
+	if (header.section.globals.count != 1)
+	{
+		return false;
+	}
+
+	FOR_ELEMS(it, regions, region_count)
+	{
+		if
+		(
+			(region_coords_of(it->coords) != it->coords)                                                                 ||
+			(it->status != RegionStatus::resident && it->status != RegionStatus::stored)                                 ||
+			(it->file_offset > header.section.region_file_bytes.count)                                                   ||
+			(it->file_size > header.section.region_file_bytes.count - it->file_offset)                                   ||
+			(it->status == RegionStatus::stored && !it->file_size)
+		)
+		{
+			return false;
+		}
+	}
+
+	i64 tree_capacity = 0;
+	FOR_ELEMS(it, chunks, chunk_count)
+	{
+		if
+		(
+			(chunk_coords_of(it->coords) != it->coords)                                                                                 ||
+			(!IN_RANGE(it->tree_count, 0, (TREE_LIST_MIN_CAPACITY << (TREE_LIST_CLASS_COUNT - 1)) + 1))                                ||
+			(it->first_tree < 0 || static_cast<u64>(it->first_tree) + static_cast<u64>(it->tree_count) > header.section.trees.count) ||
+			(it->tile_feature_count < 0)                                                                                                ||
+			(it->first_tile_feature < 0 || static_cast<u64>(it->first_tile_feature) + static_cast<u64>(it->tile_feature_count) > header.section.tile_features.count)
+		)
+		{
+			return false;
+		}
+		tree_capacity += it->tree_count ? tree_list_capacity_of(it->tree_count) : 0;
+	}
+
+	FOR_ELEMS(it, cold_chunks, cold_chunk_count)
+	{
+		if
+		(
+			(chunk_coords_of(it->coords) != it->coords)                ||
+			(!IN_RANGE(it->tree_count, 0, COLD_CHUNK_TREE_MAX + 1))
+		)
+		{
+			return false;
+		}
+	}
+
+	// @NOTE@ Every monstar's slot has to point back at it, and the free list has to run through exactly the rest of the slots.
+	if
+	(
+		(header.section.monstar_elem_slots.count != header.section.monstars.count)                                                ||
+		(header.section.monstar_hot_lanes.count != static_cast<u64>(state->monstars.HOT_LANE_COUNT) * header.section.monstars.count) ||
+		(monstar_slot_count > capacityof(state->monstars.slots))                                                                  ||
+		(monstar_count > monstar_slot_count)                                                                                      ||
+		(!IN_RANGE(globals->monstar_free_slot, 0, monstar_slot_count + 1))
+	)
+	{
+		return false;
+	}
+	FOR_ELEMS(it, monstar_elem_slots, monstar_count)
+	{
+		if (*it >= static_cast<u64>(monstar_slot_count) || monstar_slots[*it].index != it_index)
+		{
+			return false;
+		}
+	}
+	{
+		i32 free_slot = globals->monstar_free_slot;
+		FOR_RANGE(monstar_slot_count - monstar_count)
+		{
+			if (!free_slot)
+			{
+				return false;
+			}
+
+			EntityPoolSlot* slot = &monstar_slots[free_slot - 1];
+			if
+			(
+				(!IN_RANGE(slot->index, 0, monstar_slot_count + 1))                                                             ||
+				(IN_RANGE(slot->index, 0, monstar_count) && monstar_elem_slots[slot->index] == static_cast<u32>(free_slot - 1))
+			)
+			{
+				return false;
+			}
+			free_slot = slot->index;
+		}
+		if (free_slot)
+		{
+			return false;
+		}
+	}
+
+	// @NOTE@ The new world's laid out over the current one before anything's touched, so the world is never left half-loaded.
+	// Allocating only moves the arena's cursor, and it's on a copy of it, so the current world stays intact until it's thrown away.
+	lambda slot_capacity_of =
+		[&](i64 count)
+		{
+			i64 capacity = COORDS_MAP_INITIAL_CAPACITY;
+			while (count * 8 > capacity * 7)
+			{
+				capacity *= 2;
+			}
+			return capacity;
+		};
+	i64                       region_slot_capacity     = slot_capacity_of(region_count    );
+	i64                       chunk_slot_capacity      = slot_capacity_of(chunk_map_count );
+	i64                       cold_chunk_slot_capacity = slot_capacity_of(cold_chunk_count);
+	MemoryArena               world_arena              = { .used = state->world_arena_used, .size = state->arena.size, .data = state->arena.data };
+	Region*                   new_regions              = allocate<Region                  >(&world_arena, region_count);
+	CoordsMapSlot<Region   >* new_region_slots         = allocate<CoordsMapSlot<Region   >>(&world_arena, region_slot_capacity);
+	Chunk*                    new_chunks               = allocate<Chunk                   >(&world_arena, chunk_count);
+	CoordsMapSlot<Chunk    >* new_chunk_slots          = allocate<CoordsMapSlot<Chunk    >>(&world_arena, chunk_slot_capacity);
+	Tree*                     new_trees                = allocate<Tree                    >(&world_arena, tree_capacity);
+	TileFeature*              new_tile_features        = allocate<TileFeature             >(&world_arena, static_cast<i64>(header.section.tile_features.count));
+	ColdChunk*                new_cold_chunks          = allocate<ColdChunk               >(&world_arena, cold_chunk_count);
+	CoordsMapSlot<ColdChunk>* new_cold_chunk_slots     = allocate<CoordsMapSlot<ColdChunk>>(&world_arena, cold_chunk_slot_capacity);
+	if
+	(
+		(!new_regions         ) ||
+		(!new_region_slots    ) ||
+		(!new_chunks          ) ||
+		(!new_chunk_slots     ) ||
+		(!new_trees           ) ||
+		(!new_tile_features   ) ||
+		(!new_cold_chunks     ) ||
+		(!new_cold_chunk_slots)
+	)
+	{
+		return false;
+	}
+
+	//
+	// Throw away the current world.
+	//
+
+	cancel_generation_jobs(state);
+	finish_streaming_jobs(state, PlatformFreeFileData, true);
+
+	memset(new_region_slots    , 0, static_cast<u64>(region_slot_capacity    ) * sizeof(CoordsMapSlot<Region   >));
+	memset(new_chunk_slots     , 0, static_cast<u64>(chunk_slot_capacity     ) * sizeof(CoordsMapSlot<Chunk    >));
+	memset(new_cold_chunk_slots, 0, static_cast<u64>(cold_chunk_slot_capacity) * sizeof(CoordsMapSlot<ColdChunk>));
+
+	state->arena.used         = world_arena.used;
+	state->chunk_map          = { .capacity = chunk_slot_capacity, .slots = new_chunk_slots };
+	state->free_chunks        = 0;
+	state->free_tile_features = 0;
+	state->last_found_chunk   = 0;
+	state->changed_chunks     = 0;
+	state->streaming.regions  = { .capacity = region_slot_capacity, .slots = new_region_slots };
+	state->sim_region         = {};
+
+	state->cold_chunks.sweep_index      = 0;
+	state->cold_chunks.chunks           = { .capacity = cold_chunk_slot_capacity, .slots = new_cold_chunk_slots };
+	state->cold_chunks.free_cold_chunks = 0;
+	state->cold_chunks.changed_chunks   = 0;
+	state->cold_chunks.warm_bytes       = 0;
+	FOR_ELEMS(it, state->free_tree_lists)
+	{
+		*it = 0;
+	}
+
+	//
+	// Copy the save in.
+	//
+
+	state->seed             = globals->seed;
+	state->streaming.radius = globals->streaming_radius;
+	state->sim_time         = globals->sim_time;
+	state->hero             = globals->hero;
+	state->pet              = globals->pet;
+	state->pressure_plate   = globals->pressure_plate;
+	state->camera_coords    = globals->camera_coords;
+	state->camera_rel_pos   = globals->camera_rel_pos;
+
+	// @NOTE@ The maps were laid out big enough for everything going into them, so none of the inserts grow them.
+	FOR_ELEMS(it, new_regions, region_count)
+	{
+		*it = { .coords = regions[it_index].coords, .status = regions[it_index].status };
+		insert(&state->streaming.regions, &state->arena, it->coords, it);
+	}
+
+	FOR_ELEMS(it, chunks, chunk_count)
+	{
+		// @NOTE@ Just touched, so loaded chunks don't all go cold at once.
+		Chunk* chunk = &new_chunks[it_index];
+		*chunk              = {};
+		chunk->coords       = it->coords;
+		chunk->touched_tick = state->cold_chunks.tick;
+		memcpy(reinterpret_cast<byte*>(chunk) + offsetof(Chunk, summary), it->tail, sizeof(it->tail));
+
+		if (it->tree_count)
+		{
+			chunk->tree_capacity = tree_list_capacity_of(it->tree_count);
+			chunk->tree_count    = it->tree_count;
+			chunk->trees         = new_trees;
+			new_trees           += chunk->tree_capacity;
+			memcpy(chunk->trees, trees + it->first_tree, static_cast<u64>(it->tree_count) * sizeof(Tree));
+		}
+
+		FOR_RANGE_REV(i, it->tile_feature_count)
+		{
+			SavedTileFeature* saved_tile_feature = &tile_features[it->first_tile_feature + i];
+			TileFeature*      feature            = &new_tile_features[it->first_tile_feature + i];
+			*feature        =
+				{
+					.next           = chunk->features,
+					.coords         = saved_tile_feature->coords,
+					.pressure_plate = saved_tile_feature->has_pressure_plate ? &state->pressure_plate : 0
+				};
+			chunk->features = feature;
+		}
+
+		insert(&state->chunk_map, &state->arena, chunk->coords, chunk);
+		mark_chunk_changed(state, chunk);
+	}
+
+	memset(&state->monstars, 0, sizeof(state->monstars));
+	state->monstars.count      = static_cast<i32>(monstar_count);
+	state->monstars.slot_count = static_cast<i32>(monstar_slot_count);
+	state->monstars.free_slot  = globals->monstar_free_slot;
+	memcpy(state->monstars.elems     , monstars          , static_cast<u64>(monstar_count     ) * sizeof(Monstar       ));
+	memcpy(state->monstars.elem_slots, monstar_elem_slots, static_cast<u64>(monstar_count     ) * sizeof(u32           ));
+	memcpy(state->monstars.slots     , monstar_slots     , static_cast<u64>(monstar_slot_count) * sizeof(EntityPoolSlot));
+	FOR_RANGE(lane, state->monstars.HOT_LANE_COUNT)
+	{
+		memcpy(hot_lanes_of(&state->monstars, lane), monstar_hot_lanes + lane * monstar_count, static_cast<u64>(monstar_count) * sizeof(u32));
+	}
+
+	FOR_ELEMS(it, new_cold_chunks, cold_chunk_count)
+	{
+		// @NOTE@ Changed on being loaded, like the warm chunks.
+		state->change_generation += 1;
+		*it = { .change_generation = state->change_generation, .packed = cold_chunks[it_index] };
+		insert(&state->cold_chunks.chunks, &state->arena, it->packed.coords, it);
+		relink_changed_chunk(state, &state->cold_chunks.changed_chunks, it);
+		state->cold_chunks.warm_bytes += warm_bytes_of(it->packed.tree_count);
+	}
+
+	//
+	// Put stored regions back on disk.
+	//
+
+	FOR_ELEMS(it, new_regions, region_count)
+	{
+		if (it->status != RegionStatus::stored)
+		{
+			continue;
+		}
+
+		char   file_path_buffer[sizeof(StreamingJob::file_path_buffer)];
+		String region_file_path = region_file_path_of(&file_path_buffer, it->coords);
+		if (!PlatformWriteFile(region_file_path, region_file_bytes + regions[it_index].file_offset, regions[it_index].file_size))
+		{
+			// @NOTE@ Generated afresh instead, since a resident region's missing chunks get generated as they come into range.
+			DEBUG_printf(__FILE__ " :: Couldn't write region file `%.*s` back out; the region will be regenerated.\n", PASS_ISTR(region_file_path));
+			it->status                             = RegionStatus::resident;
+			state->streaming.stats.failure_count += 1;
+		}
+	}
+
+	return true;
+}
+
+#pragma clang diagnostic pop
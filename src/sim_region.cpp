@@ -0,0 +1,189 @@
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wunused-function"
+
+// @NOTE@ Only the creatures in chunks within `SIM_REGION_RADIUS` of the hero or the camera get gathered into the sim region and simulated;
+// everything else is dormant and left exactly where it is. A creature coming back into the sim region is caught up in one cheap step:
+// its timers and offsets jump ahead by however long it was dormant, but it doesn't move or fight for any of that time.
+
+procedure void catch_up(Pet* pet, f32 dormant_time)
+{
+	pet->hover_t = mod(pet->hover_t + dormant_time / 2.0f, 1.0f);
+	pet->move_t  = min(pet->move_t + dormant_time / 0.5f, 1.0f);
+}
+
+procedure void catch_up(MonstarPool* pool, Monstar* monstar, f32 dormant_time)
+{
+	aliasing hot   = pool->hot;
+	i64      index = monstar - pool->elems;
+	if (monstar->hp)
+	{
+		f32 factor = dampen_factor(0.01f, dormant_time);
+		hot.rel_pos_x[index] = dampen(hot.rel_pos_x[index], 0.0f, factor);
+		hot.rel_pos_y[index] = dampen(hot.rel_pos_y[index], 0.0f, factor);
+		if (+(monstar->flag & MonstarFlag::flying))
+		{
+			hot.hover_t[index] = mod(hot.hover_t[index] + dormant_time / hot.hover_period[index], 1.0f);
+		}
+		hot.move_t[index] = min(hot.move_t[index] + dormant_time / hot.move_period[index], 1.0f);
+	}
+	else
+	{
+		hot.existence_t[index] = max(hot.existence_t[index] - dormant_time, 0.0f);
+		hot.rel_pos_z  [index] = dampen(hot.rel_pos_z[index], 0.0f, 0.1f, dormant_time);
+	}
+}
+
+// @NOTE@ `previous_sim_time` is what `State::sim_time` was before this update; whoever was simulated last update has exactly that stamped on them.
+// Only ever given creatures' handles, so there's no chunk to resolve them against; a stale one is skipped.
+procedure void add_to_sim_region(State* state, EntityHandle handle, f64 previous_sim_time)
+{
+	aliasing region = state->sim_region;
+	if (region.entity_count == SIM_REGION_ENTITY_CAPACITY)
+	{
+		region.overflow_count += 1;
+		return;
+	}
+
+	EntityRef entity = entity_of(state, 0, handle);
+	switch (entity.ref_type)
+	{
+		case EntityType::Pet:
+		{
+			if (entity.Pet_->simulated_time != previous_sim_time)
+			{
+				catch_up(entity.Pet_, static_cast<f32>(previous_sim_time - entity.Pet_->simulated_time));
+				region.caught_up_count += 1;
+			}
+		} break;
+
+		case EntityType::Monstar:
+		{
+			if (entity.Monstar_->simulated_time != previous_sim_time)
+			{
+				catch_up(&state->monstars, entity.Monstar_, static_cast<f32>(previous_sim_time - entity.Monstar_->simulated_time));
+				region.caught_up_count += 1;
+			}
+		} break;
+
+		case EntityType::null:
+		case EntityType::Hero:
+		case EntityType::Tree:
+		case EntityType::PressurePlate:
+		{
+			return;
+		} break;
+	}
+
+	aliasing count = region.entities.counts[static_cast<i32>(entity.ref_type)];
+	elems_of(&region.entities, entity.ref_type)[count]  = handle;
+	count                                              += 1;
+	region.entity_count                                += 1;
+}
+
+procedure bool32 is_in_sim_region(SimRegion* region, vi2 coords)
+{
+	FOR_ELEMS(it, region->min_chunk_coords)
+	{
+		vi2 chunk_coords = chunk_coords_of(coords);
+		if
+		(
+			IN_RANGE(chunk_coords.x, it->x, region->max_chunk_coords[it_index].x + 1) &&
+			IN_RANGE(chunk_coords.y, it->y, region->max_chunk_coords[it_index].y + 1)
+		)
+		{
+			return true;
+		}
+	}
+	return false;
+}
+
+procedure void begin_sim_region(State* state, f64 previous_sim_time)
+{
+	aliasing region = state->sim_region;
+	region.entity_count    = 0;
+	memset(region.entities.counts, 0, sizeof(region.entities.counts));
+	region.caught_up_count = 0;
+	region.overflow_count  = 0;
+
+	vi2 foci[] = { state->hero.coords, state->camera_coords };
+	static_assert(sizeof(foci) == sizeof(SimRegion::min_chunk_coords));
+	FOR_ELEMS(focus, foci)
+	{
+		region.min_chunk_coords[focus_index] = chunk_coords_of(*focus - vx2(SIM_REGION_RADIUS));
+		region.max_chunk_coords[focus_index] = chunk_coords_of(*focus + vx2(SIM_REGION_RADIUS));
+	}
+
+	FOR_ELEMS(focus, foci)
+	{
+		vi2 min_chunk_coords = region.min_chunk_coords[focus_index];
+		vi2 max_chunk_coords = region.max_chunk_coords[focus_index];
+		FOR_RANGE(chunk_iy, min_chunk_coords.y / CHUNK_DIM, max_chunk_coords.y / CHUNK_DIM + 1)
+		{
+			FOR_RANGE(chunk_ix, min_chunk_coords.x / CHUNK_DIM, max_chunk_coords.x / CHUNK_DIM + 1)
+			{
+				vi2 chunk_coords = vi2 { chunk_ix, chunk_iy } * CHUNK_DIM;
+
+				// @NOTE@ Chunks the foci share are only gathered from once.
+				bool32 is_gathered = false;
+				FOR_RANGE(i, focus_index)
+				{
+					is_gathered |=
+						IN_RANGE(chunk_coords.x, region.min_chunk_coords[i].x, region.max_chunk_coords[i].x + 1) &&
+						IN_RANGE(chunk_coords.y, region.min_chunk_coords[i].y, region.max_chunk_coords[i].y + 1);
+				}
+				if (is_gathered)
+				{
+					continue;
+				}
+
+				Chunk* chunk = find_chunk(state, chunk_coords);
+				if (!chunk || !chunk->summary.creature_count)
+				{
+					continue;
+				}
+
+				FOR_ELEMS(word, chunk->creature_bitmap.words)
+				{
+					for (u64 bits = *word; bits; bits &= bits - 1)
+					{
+						i32 bit_index = static_cast<i32>(word_index) * 64 + static_cast<i32>(count_trailing_zeros(bits));
+						add_to_sim_region(state, chunk->tiles[bit_index / CHUNK_DIM][bit_index % CHUNK_DIM], previous_sim_time);
+					}
+				}
+			}
+		}
+	}
+}
+
+procedure void stamp_simulated_pets(EntityHandle* handles, i32 count, State* state)
+{
+	// @NOTE@ There's only ever the one pet.
+	ASSERT(count == 1 && index_of(*handles) == 0);
+	state->pet.simulated_time = state->sim_time;
+}
+
+procedure void stamp_simulated_monstars(EntityHandle* handles, i32 count, State* state)
+{
+	FOR_ELEMS(it, handles, count)
+	{
+		Monstar* monstar = find(&state->monstars, index_of(*it));
+		if (monstar)
+		{
+			monstar->simulated_time = state->sim_time;
+		}
+	}
+}
+
+// @NOTE@ Stamps everyone that got simulated; anyone left with an older stamp was dormant. Monstars despawned since they were gathered are skipped.
+procedure void end_sim_region(State* state)
+{
+	global constexpr EntityBatches<EntityHandle, State> STAMPS =
+		{
+			.Pet_     = stamp_simulated_pets,
+			.Monstar_ = stamp_simulated_monstars
+		};
+
+	dispatch(&state->sim_region.entities, STAMPS, state);
+}
+
+#pragma clang diagnostic pop
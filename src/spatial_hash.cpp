@@ -0,0 +1,242 @@
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wunused-function"
+#include <emmintrin.h>
+
+// @NOTE@ Points at continuous positions, in meters like `coords + rel_pos.xy`, binned into the square cells of a uniform grid for distance queries
+// that don't go through the tiles. The grid's unbounded, so it's wrapped onto a power of two of buckets, and cells a wrap apart share a bucket.
+// Wrapping rather than hashing keeps neighboring cells in neighboring buckets and lets the buckets be worked out four points at a time.
+// Meant to be thrown away and built afresh out of an arena every update: a pass to work out the buckets, a pass to count the points in each
+// (which ranks each point within its bucket on the way), a pass to sum the counts into where each bucket starts, and a pass to scatter the points into place.
+
+constexpr i32 SPATIAL_HASH_MIN_BUCKET_COUNT  = 64;
+constexpr i32 SPATIAL_HASH_POINTS_PER_BUCKET = 8;  // @NOTE@ About, for however many points it's built with.
+
+struct SpatialHash
+{
+	f32  cells_per_meter;
+	i32  count;
+	vi2  wrap_mask;       // @NOTE@ How many cells across the buckets wrap, minus one.
+	i32  wrap_shift;      // @NOTE@ A bucket is the wrapped cell's x, then its y shifted up by this.
+	i32* bucket_starts;   // @NOTE@ One more than there are buckets, so each bucket ends where the next one starts.
+	vf2* positions;       // @NOTE@ Grouped by bucket, but otherwise in the order they were given.
+	i32* indices;         // @NOTE@ Into the positions the hash was built from; indexed like `positions`.
+};
+
+struct SpatialHashQuery
+{
+	SpatialHash* hash;
+	vf2          center;
+	f32          radius_squared;
+	vi2          min_cell;
+	vi2          max_cell;       // @NOTE@ Inclusive, and never more than a wrap past `min_cell`, so no bucket is visited twice.
+	vi2          cell;
+	i32          point_index;    // @NOTE@ Into the hash's points; the rest of the cell's bucket is up to `bucket_end`.
+	i32          bucket_end;
+};
+
+struct SpatialHashResult
+{
+	i32* indices;
+	i32  count;
+};
+
+// @NOTE@ `floorf` without the call, for positions well within an `i32` of cells. Does exactly what the vector loop of `build_spatial_hash` does.
+procedure vi2 cell_of(SpatialHash* hash, vf2 position)
+{
+	vf2 cells = position * hash->cells_per_meter;
+	vi2 cell  = { static_cast<i32>(cells.x), static_cast<i32>(cells.y) };
+	return cell - vi2 { static_cast<f32>(cell.x) > cells.x, static_cast<f32>(cell.y) > cells.y };
+}
+
+procedure u32 bucket_of(SpatialHash* hash, vi2 cell)
+{
+	return static_cast<u32>((cell.x & hash->wrap_mask.x) | ((cell.y & hash->wrap_mask.y) << hash->wrap_shift));
+}
+
+// @NOTE@ Empty if there isn't room in the arena.
+procedure SpatialHash build_spatial_hash(MemoryArena* arena, vf2* positions, i32 count, f32 cell_dim)
+{
+	ASSERT(count >= 0 && cell_dim > 0.0f);
+
+	i32 bucket_bits = 0;
+	while ((1 << bucket_bits) < max(count / SPATIAL_HASH_POINTS_PER_BUCKET, SPATIAL_HASH_MIN_BUCKET_COUNT))
+	{
+		bucket_bits += 1;
+	}
+	i32 bucket_count = 1 << bucket_bits;
+
+	SpatialHash hash =
+		{
+			.cells_per_meter = 1.0f / cell_dim,
+			.count           = count,
+			.wrap_mask       = { (1 << (bucket_bits / 2)) - 1, (1 << (bucket_bits - bucket_bits / 2)) - 1 },
+			.wrap_shift      = bucket_bits / 2,
+			.bucket_starts   = allocate<i32>(arena, bucket_count + 1),
+			.positions       = allocate<vf2>(arena, max(count, 1)),
+			.indices         = allocate<i32>(arena, max(count, 1))
+		};
+
+	DEFER_ARENA_RESET(arena);
+	u32* buckets = allocate<u32>(arena, max(count, 1));
+	i32* ranks   = allocate<i32>(arena, max(count, 1));
+	if (!hash.bucket_starts || !hash.positions || !hash.indices || !buckets || !ranks)
+	{
+		return {};
+	}
+
+	{
+		const __m128  CELLS_PER_METER = _mm_set1_ps(hash.cells_per_meter);
+		const __m128i WRAP_MASK_X     = _mm_set1_epi32(hash.wrap_mask.x);
+		const __m128i WRAP_MASK_Y     = _mm_set1_epi32(hash.wrap_mask.y);
+
+		i32 index = 0;
+		for (; index + 4 <= count; index += 4)
+		{
+			__m128 xyxy_lo = _mm_loadu_ps(&positions[index    ].x);
+			__m128 xyxy_hi = _mm_loadu_ps(&positions[index + 2].x);
+			__m128 cells_x = _mm_mul_ps(_mm_shuffle_ps(xyxy_lo, xyxy_hi, _MM_SHUFFLE(2, 0, 2, 0)), CELLS_PER_METER);
+			__m128 cells_y = _mm_mul_ps(_mm_shuffle_ps(xyxy_lo, xyxy_hi, _MM_SHUFFLE(3, 1, 3, 1)), CELLS_PER_METER);
+
+			// @NOTE@ Truncated, then one less wherever that went up; the comparison's all ones there, which is minus one.
+			__m128i cell_x = _mm_cvttps_epi32(cells_x);
+			__m128i cell_y = _mm_cvttps_epi32(cells_y);
+			cell_x = _mm_add_epi32(cell_x, _mm_castps_si128(_mm_cmpgt_ps(_mm_cvtepi32_ps(cell_x), cells_x)));
+			cell_y = _mm_add_epi32(cell_y, _mm_castps_si128(_mm_cmpgt_ps(_mm_cvtepi32_ps(cell_y), cells_y)));
+
+			__m128i bucket = _mm_or_si128(_mm_and_si128(cell_x, WRAP_MASK_X), _mm_sll_epi32(_mm_and_si128(cell_y, WRAP_MASK_Y), _mm_cvtsi32_si128(hash.wrap_shift)));
+			_mm_storeu_si128(reinterpret_cast<__m128i*>(&buckets[index]), bucket);
+		}
+		for (; index < count; index += 1)
+		{
+			buckets[index] = bucket_of(&hash, cell_of(&hash, positions[index]));
+		}
+	}
+
+	// @NOTE@ Ranking each point by how many came before it in its bucket keeps the buckets in order and leaves the scatter nothing to write back.
+	memset(hash.bucket_starts, 0, static_cast<u64>(bucket_count + 1) * sizeof(i32));
+	FOR_ELEMS(it, buckets, count)
+	{
+		ranks[it_index]          = hash.bucket_starts[*it];
+		hash.bucket_starts[*it] += 1;
+	}
+
+	i32 sum = 0;
+	FOR_ELEMS(it, hash.bucket_starts, bucket_count + 1)
+	{
+		i32 bucket_size = *it;
+		*it  = sum;
+		sum += bucket_size;
+	}
+
+	FOR_ELEMS(it, buckets, count)
+	{
+		i32 index = hash.bucket_starts[*it] + ranks[it_index];
+		hash.positions[index] = positions[it_index];
+		hash.indices  [index] = static_cast<i32>(it_index);
+	}
+
+	return hash;
+}
+
+procedure void enter_cell(SpatialHashQuery* query)
+{
+	u32 bucket = bucket_of(query->hash, query->cell);
+	query->point_index = query->hash->bucket_starts[bucket    ];
+	query->bucket_end  = query->hash->bucket_starts[bucket + 1];
+}
+
+// @NOTE@ Points exactly `radius` away count.
+procedure SpatialHashQuery begin_radius_query(SpatialHash* hash, vf2 center, f32 radius)
+{
+	ASSERT(radius >= 0.0f);
+	if (!hash->bucket_starts)
+	{
+		return { .hash = hash, .min_cell = { 0, 0 }, .max_cell = { -1, -1 } };
+	}
+
+	SpatialHashQuery query =
+		{
+			.hash           = hash,
+			.center         = center,
+			.radius_squared = square(radius),
+			.min_cell       = cell_of(hash, center - vx2(radius))
+		};
+	query.max_cell = cell_of(hash, center + vx2(radius));
+	query.max_cell = { min(query.max_cell.x, query.min_cell.x + hash->wrap_mask.x), min(query.max_cell.y, query.min_cell.y + hash->wrap_mask.y) };
+	query.cell     = query.min_cell;
+	enter_cell(&query);
+	return query;
+}
+
+// @NOTE@ Points from cells a wrap away share the bucket, and are either too far away to pass or in cells of the query that were skipped
+// so as not to visit their bucket twice.
+procedure bool32 next(i32* index, vf2* position, SpatialHashQuery* query)
+{
+	SpatialHash* hash = query->hash;
+	while (query->cell.y <= query->max_cell.y)
+	{
+		while (query->point_index < query->bucket_end)
+		{
+			i32 point_index = query->point_index;
+			query->point_index += 1;
+
+			vf2 point = hash->positions[point_index];
+			if (square(point.x - query->center.x) + square(point.y - query->center.y) <= query->radius_squared)
+			{
+				*index = hash->indices[point_index];
+				if (position)
+				{
+					*position = point;
+				}
+				return true;
+			}
+		}
+
+		query->cell.x += 1;
+		if (query->cell.x > query->max_cell.x)
+		{
+			query->cell.x  = query->min_cell.x;
+			query->cell.y += 1;
+		}
+		if (query->cell.y <= query->max_cell.y)
+		{
+			enter_cell(query);
+		}
+	}
+
+	return false;
+}
+
+// @NOTE@ Reserves room for every point in every bucket the query visits, so the results are contiguous without a second query.
+procedure SpatialHashResult query_radius(MemoryArena* arena, SpatialHash* hash, vf2 center, f32 radius)
+{
+	SpatialHashQuery query = begin_radius_query(hash, center, radius);
+
+	i64 point_count = 0;
+	FOR_RANGE(cell_y, query.min_cell.y, query.max_cell.y + 1)
+	{
+		FOR_RANGE(cell_x, query.min_cell.x, query.max_cell.x + 1)
+		{
+			u32 bucket = bucket_of(hash, { cell_x, cell_y });
+			point_count += hash->bucket_starts[bucket + 1] - hash->bucket_starts[bucket];
+		}
+	}
+
+	SpatialHashResult result = { .indices = allocate<i32>(arena, max(point_count, 1LL)) };
+	if (!result.indices)
+	{
+		return {};
+	}
+
+	i32 index;
+	while (next(&index, 0, &query))
+	{
+		ASSERT(result.count < point_count);
+		result.indices[result.count] = index;
+		result.count                += 1;
+	}
+
+	return result;
+}
+
+#pragma clang diagnostic pop
@@ -0,0 +1,261 @@
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wunused-function"
+
+// @NOTE@ Tile-based entity queries that only visit the chunks overlapping the query.
+// The iterator forms visit entities in place; the `query_*` forms materialize them into an arena.
+// Cold chunks are passed over rather than thawed, so querying never changes the world; they're only ever away from the hero and the camera.
+
+struct RectQuery
+{
+	State* state;
+	vi2    min_coords;      // @NOTE@ Inclusive.
+	vi2    max_coords;      // @NOTE@ Exclusive.
+	vi2    center;          // @NOTE@ Only for radius queries.
+	i32    radius_squared;  // @NOTE@ Negative for plain rect queries.
+	vi2    chunk_coords;
+	Chunk* chunk;
+	vi2    chunk_min_coords;
+	vi2    chunk_max_coords;
+	vi2    coords;
+};
+
+struct LineQuery
+{
+	State* state;
+	vi2    coords;
+	vi2    end_coords;
+	vi2    delta;
+	vi2    step;
+	i32    error;
+	bool32 done;
+};
+
+struct QueryResult
+{
+	EntityRef* entities;
+	i32        count;
+};
+
+procedure RectQuery begin_rect_query(State* state, vi2 min_coords, vi2 max_coords)
+{
+	return
+		{
+			.state          = state,
+			.min_coords     = min_coords,
+			.max_coords     = max_coords,
+			.radius_squared = -1,
+			.chunk_coords   = chunk_coords_of(min_coords)
+		};
+}
+
+procedure RectQuery begin_radius_query(State* state, vi2 center, i32 radius)
+{
+	ASSERT(radius >= 0);
+	RectQuery query = begin_rect_query(state, center - vx2(radius), center + vx2(radius + 1));
+	query.center         = center;
+	query.radius_squared = square(radius);
+	return query;
+}
+
+procedure bool32 next(EntityRef* entity, vi2* coords, RectQuery* query)
+{
+	if (query->min_coords.x >= query->max_coords.x || query->min_coords.y >= query->max_coords.y)
+	{
+		return false;
+	}
+
+	vi2 last_chunk_coords = chunk_coords_of(query->max_coords - vx2(1));
+	while (true)
+	{
+		if (query->chunk)
+		{
+			while (query->coords.y < query->chunk_max_coords.y)
+			{
+				while (query->coords.x < query->chunk_max_coords.x)
+				{
+					vi2 tile_coords = query->coords;
+					query->coords.x += 1;
+
+					vi2          rel_coords = rel_coords_of(tile_coords);
+					EntityHandle tile       = query->chunk->tiles[rel_coords.y][rel_coords.x];
+					if
+					(
+						type_of(tile) != EntityType::null &&
+						(query->radius_squared < 0 || square(tile_coords.x - query->center.x) + square(tile_coords.y - query->center.y) <= query->radius_squared)
+					)
+					{
+						*entity = entity_of(query->state, query->chunk, tile);
+						if (coords)
+						{
+							*coords = tile_coords;
+						}
+						return true;
+					}
+				}
+
+				query->coords.x  = query->chunk_min_coords.x;
+				query->coords.y += 1;
+			}
+
+			query->chunk = 0;
+
+			query->chunk_coords.x += CHUNK_DIM;
+			if (query->chunk_coords.x > last_chunk_coords.x)
+			{
+				query->chunk_coords.x  = chunk_coords_of(query->min_coords).x;
+				query->chunk_coords.y += CHUNK_DIM;
+			}
+		}
+
+		if (query->chunk_coords.y > last_chunk_coords.y)
+		{
+			return false;
+		}
+
+		query->chunk = find_chunk(query->state, query->chunk_coords);
+		if (query->chunk)
+		{
+			query->chunk_min_coords = { max(query->min_coords.x, query->chunk_coords.x            ), max(query->min_coords.y, query->chunk_coords.y            ) };
+			query->chunk_max_coords = { min(query->max_coords.x, query->chunk_coords.x + CHUNK_DIM), min(query->max_coords.y, query->chunk_coords.y + CHUNK_DIM) };
+			query->coords           = query->chunk_min_coords;
+		}
+		else
+		{
+			query->chunk_coords.x += CHUNK_DIM;
+			if (query->chunk_coords.x > last_chunk_coords.x)
+			{
+				query->chunk_coords.x  = chunk_coords_of(query->min_coords).x;
+				query->chunk_coords.y += CHUNK_DIM;
+			}
+		}
+	}
+}
+
+// @NOTE@ Walks the tiles from `start_coords` to `end_coords` inclusive (Bresenham), so entities come out in order along the line.
+procedure LineQuery begin_line_query(State* state, vi2 start_coords, vi2 end_coords)
+{
+	vi2 delta = { abs(end_coords.x - start_coords.x), -abs(end_coords.y - start_coords.y) };
+	return
+		{
+			.state      = state,
+			.coords     = start_coords,
+			.end_coords = end_coords,
+			.delta      = delta,
+			.step       = { start_coords.x < end_coords.x ? 1 : -1, start_coords.y < end_coords.y ? 1 : -1 },
+			.error      = delta.x + delta.y
+		};
+}
+
+procedure bool32 next(EntityRef* entity, vi2* coords, LineQuery* query)
+{
+	while (!query->done)
+	{
+		vi2 tile_coords = query->coords;
+
+		if (query->coords == query->end_coords)
+		{
+			query->done = true;
+		}
+		else
+		{
+			i32 error = query->error * 2;
+			if (error >= query->delta.y)
+			{
+				query->error    += query->delta.y;
+				query->coords.x += query->step.x;
+			}
+			if (error <= query->delta.x)
+			{
+				query->error    += query->delta.x;
+				query->coords.y += query->step.y;
+			}
+		}
+
+		Chunk* chunk = find_chunk(query->state, tile_coords);
+		if (chunk)
+		{
+			vi2          rel_coords = rel_coords_of(tile_coords);
+			EntityHandle tile       = chunk->tiles[rel_coords.y][rel_coords.x];
+			if (type_of(tile) != EntityType::null)
+			{
+				*entity = entity_of(query->state, chunk, tile);
+				if (coords)
+				{
+					*coords = tile_coords;
+				}
+				return true;
+			}
+		}
+	}
+
+	return false;
+}
+
+// @NOTE@ Just how many tiles in the rect are occupied, straight from the chunks' occupancy bitmaps; no tiles or entities are looked at.
+procedure i64 count_occupied_tiles(State* state, vi2 min_coords, vi2 max_coords)
+{
+	if (min_coords.x >= max_coords.x || min_coords.y >= max_coords.y)
+	{
+		return 0;
+	}
+
+	i64 count             = 0;
+	vi2 min_chunk_coords  = chunk_coords_of(min_coords);
+	vi2 last_chunk_coords = chunk_coords_of(max_coords - vx2(1));
+	FOR_RANGE(chunk_iy, min_chunk_coords.y / CHUNK_DIM, last_chunk_coords.y / CHUNK_DIM + 1)
+	{
+		FOR_RANGE(chunk_ix, min_chunk_coords.x / CHUNK_DIM, last_chunk_coords.x / CHUNK_DIM + 1)
+		{
+			Chunk* chunk = find_chunk(state, vi2 { chunk_ix, chunk_iy } * CHUNK_DIM);
+			if (chunk)
+			{
+				vi2 min_rel_coords = { max(min_coords.x - chunk->coords.x, 0), max(min_coords.y - chunk->coords.y, 0) };
+				vi2 max_rel_coords = { min(max_coords.x - chunk->coords.x, CHUNK_DIM), min(max_coords.y - chunk->coords.y, CHUNK_DIM) };
+				count += count_set_tiles(&chunk->occupied_bitmap, min_rel_coords, max_rel_coords);
+			}
+		}
+	}
+	return count;
+}
+
+// @NOTE@ Reserves room for at most `entity_count` entities, so the results are contiguous without going over the tiles twice.
+template <typename QUERY>
+procedure QueryResult collect(MemoryArena* arena, QUERY query, i64 entity_count)
+{
+	QueryResult result = { .entities = allocate<EntityRef>(arena, max(entity_count, 1LL)) };
+	if (!result.entities)
+	{
+		return {};
+	}
+
+	EntityRef entity;
+	while (next(&entity, 0, &query))
+	{
+		ASSERT(result.count < entity_count);
+		result.entities[result.count] = entity;
+		result.count                 += 1;
+	}
+
+	return result;
+}
+
+// @NOTE@ Sized by the occupancy bitmaps, which count exactly the entities a rect query finds.
+procedure QueryResult query_rect(MemoryArena* arena, State* state, vi2 min_coords, vi2 max_coords)
+{
+	return collect(arena, begin_rect_query(state, min_coords, max_coords), count_occupied_tiles(state, min_coords, max_coords));
+}
+
+// @NOTE@ Sized by the occupied tiles of the square around the circle.
+procedure QueryResult query_radius(MemoryArena* arena, State* state, vi2 center, i32 radius)
+{
+	ASSERT(radius >= 0);
+	return collect(arena, begin_radius_query(state, center, radius), count_occupied_tiles(state, center - vx2(radius), center + vx2(radius + 1)));
+}
+
+// @NOTE@ Sized by the tiles along the line, which are never more than it is long.
+procedure QueryResult query_line(MemoryArena* arena, State* state, vi2 start_coords, vi2 end_coords)
+{
+	return collect(arena, begin_line_query(state, start_coords, end_coords), max(abs(end_coords.x - start_coords.x), abs(end_coords.y - start_coords.y)) + 1);
+}
+
+#pragma clang diagnostic pop
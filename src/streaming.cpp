@@ -0,0 +1,444 @@
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wunused-function"
+
+// @NOTE@ Regions out of range of both the hero and the camera are copied into a job's buffer, evicted, and written out on a worker thread,
+// then read back in on a worker thread once they're in range again. The frame itself only ever pays for copying chunks in and out of the buffers,
+// and at most `STREAMING_JOB_CAPACITY` regions can be in flight at once.
+
+constexpr u32 REGION_FILE_MAGIC   = 0x4E474552; // @NOTE@ "REGN".
+constexpr u32 REGION_FILE_VERSION = 2;
+
+// @NOTE@ The path's kept as a size into the job's own buffer rather than a `String` so the job doesn't point into itself.
+procedure String file_path_of(StreamingJob* job)
+{
+	return { job->file_path_size, job->file_path_buffer };
+}
+
+procedure PlatformWork_t(store_region_work)
+{
+	StreamingJob* job = reinterpret_cast<StreamingJob*>(platform_work_data);
+	job->succeeded = job->PlatformWriteFile(file_path_of(job), job->write_data, job->write_size);
+	__atomic_store_n(&job->done, true, __ATOMIC_RELEASE);
+}
+
+procedure PlatformWork_t(load_region_work)
+{
+	StreamingJob* job = reinterpret_cast<StreamingJob*>(platform_work_data);
+	job->file_data = job->PlatformReadFileData(file_path_of(job));
+	job->succeeded = job->file_data.data != 0;
+	__atomic_store_n(&job->done, true, __ATOMIC_RELEASE);
+}
+
+// @NOTE@ Chebyshev distance in tiles from `coords` to the nearest tile of the region.
+procedure i32 distance_to_region(vi2 coords, vi2 region_coords)
+{
+	i32 dx = max(max(region_coords.x - coords.x, coords.x - (region_coords.x + REGION_DIM - 1)), 0);
+	i32 dy = max(max(region_coords.y - coords.y, coords.y - (region_coords.y + REGION_DIM - 1)), 0);
+	return max(dx, dy);
+}
+
+// @NOTE@ `EXE_DIR "region_<x>_<y>.bin"`, indexed by region rather than by tile.
+procedure String region_file_path_of(char (*buffer)[sizeof(StreamingJob::file_path_buffer)], vi2 region_coords)
+{
+	static_assert(sizeof(EXE_DIR "region_-134217728_-134217728.bin") <= sizeof(*buffer));
+	i64    size   = 0;
+	lambda append =
+		[&](String str)
+		{
+			memcpy(*buffer + size, str.data, static_cast<u64>(str.size));
+			size += str.size;
+		};
+	lambda append_i32 =
+		[&](i32 x)
+		{
+			char digits[10];
+			i32  digit_count = 0;
+			u32  magnitude   = x < 0 ? 0U - static_cast<u32>(x) : static_cast<u32>(x);
+			do
+			{
+				digits[digit_count] = static_cast<char>('0' + magnitude % 10);
+				digit_count        += 1;
+				magnitude          /= 10;
+			}
+			while (magnitude);
+
+			if (x < 0)
+			{
+				append(String("-"));
+			}
+			FOR_RANGE_REV(i, digit_count)
+			{
+				(*buffer)[size] = digits[i];
+				size           += 1;
+			}
+		};
+
+	append(String(EXE_DIR "region_"));
+	append_i32(region_coords.x / REGION_DIM);
+	append(String("_"));
+	append_i32(region_coords.y / REGION_DIM);
+	append(String(".bin"));
+	return { size, *buffer };
+}
+
+procedure StreamingJob* claim_streaming_job(State* state, Region* region)
+{
+	FOR_ELEMS(job, state->streaming.jobs)
+	{
+		if (!job->in_use)
+		{
+			job->in_use         = true;
+			job->done           = false;
+			job->region         = region;
+			job->file_path_size = region_file_path_of(&job->file_path_buffer, region->coords).size;
+			return job;
+		}
+	}
+
+	return 0;
+}
+
+// @NOTE@ Rebuilds the region's chunks from what `update_streaming` wrote out; false if the data doesn't hold up, in which case some chunks may already be back.
+procedure bool32 restore_region(State* state, Region* region, byte* data, u64 size)
+{
+	ASSERT(region->status == RegionStatus::resident);
+
+	RegionFileHeader header;
+	if (size < sizeof(RegionFileHeader))
+	{
+		return false;
+	}
+	memcpy(&header, data, sizeof(RegionFileHeader));
+
+	if
+	(
+		(header.magic != REGION_FILE_MAGIC)                                                 ||
+		(header.version != REGION_FILE_VERSION)                                             ||
+		(header.coords != region->coords)                                                   ||
+		(!IN_RANGE(header.chunk_count, 0, REGION_DIM_IN_CHUNKS * REGION_DIM_IN_CHUNKS + 1))
+	)
+	{
+		return false;
+	}
+
+	u64 offset = sizeof(RegionFileHeader);
+	FOR_RANGE(header.chunk_count)
+	{
+		StoredChunk stored_chunk;
+		if (size - offset < sizeof(StoredChunk))
+		{
+			return false;
+		}
+		memcpy(&stored_chunk, data + offset, sizeof(StoredChunk));
+		offset += sizeof(StoredChunk);
+
+		if
+		(
+			(chunk_coords_of(stored_chunk.coords) != stored_chunk.coords)              ||
+			(region_coords_of(stored_chunk.coords) != region->coords)                  ||
+			(!IN_RANGE(stored_chunk.tree_count, 0, REGION_STORED_TREE_MAX + 1))        ||
+			(size - offset < static_cast<u64>(stored_chunk.tree_count) * sizeof(Tree))
+		)
+		{
+			return false;
+		}
+
+		Chunk* chunk = get_or_create_chunk(state, stored_chunk.coords);
+		if (!chunk)
+		{
+			return false;
+		}
+		ASSERT(!chunk->tree_count);
+
+		FOR_RANGE(stored_chunk.tree_count)
+		{
+			Tree tree;
+			memcpy(&tree, data + offset, sizeof(Tree));
+			offset += sizeof(Tree);
+
+			if
+			(
+				(chunk_coords_of(tree.coords) != chunk->coords)             ||
+				(test(&chunk->occupied_bitmap, rel_coords_of(tree.coords))) ||
+				(!add_tree(state, chunk, tree.coords, tree.bmp_index))
+			)
+			{
+				return false;
+			}
+		}
+	}
+
+	return offset == size;
+}
+
+// @NOTE@ Only jobs that are done get finished, unless `wait` is set, in which case every region ends up either resident or stored.
+procedure void finish_streaming_jobs(State* state, PlatformFreeFileData_t* PlatformFreeFileData, bool32 wait)
+{
+	aliasing streaming = state->streaming;
+	FOR_ELEMS(job, streaming.jobs)
+	{
+		if (!job->in_use)
+		{
+			continue;
+		}
+		if (!__atomic_load_n(&job->done, __ATOMIC_ACQUIRE))
+		{
+			if (!wait)
+			{
+				continue;
+			}
+			while (!__atomic_load_n(&job->done, __ATOMIC_ACQUIRE))
+			{
+				__builtin_ia32_pause();
+			}
+		}
+		job->in_use = false;
+
+		switch (job->region->status)
+		{
+			case RegionStatus::storing:
+			{
+				if (job->succeeded)
+				{
+					job->region->status            = RegionStatus::stored;
+					streaming.stats.store_count   += 1;
+					streaming.stats.bytes_written += static_cast<i64>(job->write_size);
+				}
+				else
+				{
+					// @NOTE@ The job's buffer still has everything, so the region is simply put back.
+					job->region->status            = RegionStatus::resident;
+					streaming.stats.failure_count += 1;
+					if (!restore_region(state, job->region, job->write_data, job->write_size))
+					{
+						DEBUG_printf(__FILE__ " :: Couldn't put region `%.*s` back after failing to store it; the rest of the region will be regenerated.\n", PASS_ISTR(file_path_of(job)));
+					}
+				}
+			} break;
+
+			case RegionStatus::loading:
+			{
+				if (job->succeeded)
+				{
+					job->region->status         = RegionStatus::resident;
+					streaming.stats.load_count += 1;
+					streaming.stats.bytes_read += static_cast<i64>(job->file_data.size);
+					if (!restore_region(state, job->region, job->file_data.data, job->file_data.size))
+					{
+						DEBUG_printf(__FILE__ " :: Region file `%.*s` is corrupt; the rest of the region is lost.\n", PASS_ISTR(file_path_of(job)));
+						streaming.stats.failure_count += 1;
+					}
+					PlatformFreeFileData(&job->file_data);
+				}
+				else
+				{
+					// @NOTE@ Left on disk to be tried again.
+					job->region->status            = RegionStatus::stored;
+					streaming.stats.failure_count += 1;
+				}
+			} break;
+
+			case RegionStatus::resident:
+			case RegionStatus::stored:
+			{
+				ASSERT(false);
+			} break;
+		}
+	}
+}
+
+procedure void update_streaming(State* state, PlatformReadFileData_t* PlatformReadFileData, PlatformFreeFileData_t* PlatformFreeFileData, PlatformWriteFile_t* PlatformWriteFile, PlatformPushWork_t* PlatformPushWork)
+{
+	aliasing streaming = state->streaming;
+	vi2      foci[]    = { state->hero.coords, state->camera_coords };
+
+	//
+	// Finish jobs.
+	//
+
+	finish_streaming_jobs(state, PlatformFreeFileData, false);
+
+	//
+	// Load regions coming into range.
+	//
+
+	FOR_ELEMS(focus, foci)
+	{
+		vi2 min_region_coords = region_coords_of(*focus - vx2(streaming.radius));
+		vi2 max_region_coords = region_coords_of(*focus + vx2(streaming.radius));
+		FOR_RANGE(region_iy, min_region_coords.y / REGION_DIM, max_region_coords.y / REGION_DIM + 1)
+		{
+			FOR_RANGE(region_ix, min_region_coords.x / REGION_DIM, max_region_coords.x / REGION_DIM + 1)
+			{
+				Region* region = find(&streaming.regions, vi2 { region_ix, region_iy } * REGION_DIM);
+				if (!region || region->status != RegionStatus::stored)
+				{
+					continue;
+				}
+
+				StreamingJob* job = claim_streaming_job(state, region);
+				if (!job)
+				{
+					goto LOADS_QUEUED;
+				}
+				job->PlatformReadFileData = PlatformReadFileData;
+
+				region->status = RegionStatus::loading;
+				if (!PlatformPushWork(load_region_work, job))
+				{
+					region->status = RegionStatus::stored;
+					job->in_use    = false;
+					goto LOADS_QUEUED;
+				}
+			}
+		}
+	}
+	LOADS_QUEUED:;
+
+	//
+	// Evict regions going out of range.
+	//
+
+	FOR_ELEMS(slot, streaming.regions.slots, streaming.regions.capacity)
+	{
+		if (!slot->distance || slot->value->status != RegionStatus::resident)
+		{
+			continue;
+		}
+		Region* region = slot->value;
+
+		// @NOTE@ A region of slack so a region on the edge doesn't bounce between being loaded and evicted.
+		bool32 in_range = false;
+		FOR_ELEMS(focus, foci)
+		{
+			in_range |= distance_to_region(*focus, region->coords) <= streaming.radius + REGION_DIM;
+		}
+		if (in_range)
+		{
+			continue;
+		}
+
+		// @NOTE@ Creatures and pressure plates live in `State`, so their tiles couldn't be rebuilt from a region file anyways.
+		// Cold chunks are written out straight from their packed trees rather than being thawed first.
+		Chunk*     chunks     [REGION_DIM_IN_CHUNKS * REGION_DIM_IN_CHUNKS];
+		ColdChunk* cold_chunks[REGION_DIM_IN_CHUNKS * REGION_DIM_IN_CHUNKS];
+		i32        chunk_count      = 0;
+		i32        cold_chunk_count = 0;
+		i32        tree_count       = 0;
+		bool32     is_pinned        = false;
+		FOR_RANGE(chunk_iy, REGION_DIM_IN_CHUNKS)
+		{
+			FOR_RANGE(chunk_ix, REGION_DIM_IN_CHUNKS)
+			{
+				vi2        chunk_coords = region->coords + vi2 { chunk_ix, chunk_iy } * CHUNK_DIM;
+				Chunk*     chunk        = find(&state->chunk_map, chunk_coords);
+				ColdChunk* cold_chunk   = chunk ? 0 : find(&state->cold_chunks.chunks, chunk_coords);
+				if (chunk)
+				{
+					is_pinned          |= chunk->summary.creature_count || chunk->summary.pressure_plate_count;
+					tree_count         += chunk->tree_count;
+					chunks[chunk_count] = chunk;
+					chunk_count        += 1;
+				}
+				else if (cold_chunk)
+				{
+					tree_count                   += cold_chunk->packed.tree_count;
+					cold_chunks[cold_chunk_count] = cold_chunk;
+					cold_chunk_count             += 1;
+				}
+			}
+		}
+		if (is_pinned || tree_count > REGION_STORED_TREE_MAX)
+		{
+			continue;
+		}
+
+		StreamingJob* job = claim_streaming_job(state, region);
+		if (!job)
+		{
+			break;
+		}
+		job->PlatformWriteFile = PlatformWriteFile;
+
+		RegionFileHeader header =
+			{
+				.magic       = REGION_FILE_MAGIC,
+				.version     = REGION_FILE_VERSION,
+				.coords      = region->coords,
+				.chunk_count = chunk_count + cold_chunk_count
+			};
+		memcpy(job->write_data, &header, sizeof(RegionFileHeader));
+		job->write_size = sizeof(RegionFileHeader);
+
+		FOR_ELEMS(it, chunks, chunk_count)
+		{
+			StoredChunk stored_chunk =
+				{
+					.coords     = (*it)->coords,
+					.tree_count = (*it)->tree_count
+				};
+			memcpy(job->write_data + job->write_size, &stored_chunk, sizeof(StoredChunk));
+			job->write_size += sizeof(StoredChunk);
+			memcpy(job->write_data + job->write_size, (*it)->trees, static_cast<u64>((*it)->tree_count) * sizeof(Tree));
+			job->write_size += static_cast<u64>((*it)->tree_count) * sizeof(Tree);
+		}
+		FOR_ELEMS(it, cold_chunks, cold_chunk_count)
+		{
+			StoredChunk stored_chunk =
+				{
+					.coords     = (*it)->packed.coords,
+					.tree_count = (*it)->packed.tree_count
+				};
+			Tree trees[COLD_CHUNK_TREE_MAX];
+			unpack_trees(trees, &(*it)->packed);
+			memcpy(job->write_data + job->write_size, &stored_chunk, sizeof(StoredChunk));
+			job->write_size += sizeof(StoredChunk);
+			memcpy(job->write_data + job->write_size, trees, static_cast<u64>(stored_chunk.tree_count) * sizeof(Tree));
+			job->write_size += static_cast<u64>(stored_chunk.tree_count) * sizeof(Tree);
+		}
+
+		region->status = RegionStatus::storing;
+		if (!PlatformPushWork(store_region_work, job))
+		{
+			region->status = RegionStatus::resident;
+			job->in_use    = false;
+			break;
+		}
+
+		FOR_ELEMS(it, chunks, chunk_count)
+		{
+			delete_chunk(state, *it);
+		}
+		FOR_ELEMS(it, cold_chunks, cold_chunk_count)
+		{
+			discard_cold_chunk(state, *it);
+		}
+	}
+
+	//
+	// Stats.
+	//
+
+	streaming.stats.resident_chunk_count  = static_cast<i32>(state->chunk_map.count);
+	streaming.stats.resident_chunk_bytes  = state->chunk_map.count * static_cast<i64>(sizeof(Chunk)) + state->chunk_map.capacity * static_cast<i64>(sizeof(CoordsMapSlot<Chunk>));
+	streaming.stats.resident_region_count = 0;
+	streaming.stats.stored_region_count   = 0;
+	streaming.stats.arena_used            = state->arena.used;
+	FOR_ELEMS(slot, state->chunk_map.slots, state->chunk_map.capacity)
+	{
+		if (slot->distance)
+		{
+			streaming.stats.resident_chunk_bytes += slot->value->tree_capacity * static_cast<i64>(sizeof(Tree));
+		}
+	}
+	FOR_ELEMS(slot, streaming.regions.slots, streaming.regions.capacity)
+	{
+		if (slot->distance)
+		{
+			streaming.stats.resident_region_count += slot->value->status == RegionStatus::resident;
+			streaming.stats.stored_region_count   += slot->value->status == RegionStatus::stored;
+		}
+	}
+}
+
+#pragma clang diagnostic pop
@@ -229,25 +229,52 @@ procedure constexpr i64 capacityof(TYPE (&xs)[SIZE]) { return static_cast<i64>(S
 
 #define DEFER_ARENA_RESET(ARENA) i64 MACRO_CONCAT(DEFER_ARENA_RESET, __LINE__) = (ARENA)->used; DEFER { (ARENA)->used = MACRO_CONCAT(DEFER_ARENA_RESET, __LINE__); }
 
+// @NOTE@ Holds how far away what it points to is from itself, so a block of memory full of these can be copied or mapped anywhere as a whole and still hold up.
+// Zero is null, since nothing points at itself. Copying one on its own (e.g. onto the stack) goes through the pointer, so the copy points at the same place.
+// The arithmetic's done on integers; pointer arithmetic across objects lets the optimizer assume the result still points into `this`.
+template <typename TYPE>
+struct OffsetPtr
+{
+	i64 offset;
+
+	OffsetPtr() = default;
+	OffsetPtr(TYPE* pointer)          { *this = pointer;                       }
+	OffsetPtr(const OffsetPtr& other) { *this = static_cast<TYPE*>(other);     }
+
+	OffsetPtr& operator=(TYPE* pointer)
+	{
+		offset = pointer ? static_cast<i64>(reinterpret_cast<u64>(pointer) - reinterpret_cast<u64>(this)) : 0;
+		return *this;
+	}
+
+	OffsetPtr& operator=(const OffsetPtr& other) { return *this = static_cast<TYPE*>(other); }
+
+	operator TYPE*  () const { return offset ? reinterpret_cast<TYPE*>(reinterpret_cast<u64>(this) + static_cast<u64>(offset)) : 0; }
+	TYPE* operator->() const { return *this; }
+};
+
 struct MemoryArena
 {
-	i64   used;
-	i64   size;
-	byte* data;
+	i64             used;
+	i64             size;
+	OffsetPtr<byte> data;
 };
 
+// @NOTE@ Aligned to `TYPE`; the arena's handed out from the top down, so any padding goes above the allocation.
 template <typename TYPE>
 procedure TYPE* allocate(MemoryArena* arena, const i64& count = 1)
 {
-	if (arena && arena->data && static_cast<i64>(sizeof(TYPE)) * count <= arena->size - arena->used)
-	{
-		arena->used += static_cast<i64>(sizeof(TYPE)) * count;
-		return reinterpret_cast<TYPE*>(arena->data + arena->size - arena->used);
-	}
-	else
+	if (arena && arena->data)
 	{
-		return 0;
+		u64 top  = reinterpret_cast<u64>(arena->data + arena->size - arena->used);
+		i64 size = static_cast<i64>(sizeof(TYPE)) * count + static_cast<i64>(top % alignof(TYPE));
+		if (size <= arena->size - arena->used)
+		{
+			arena->used += size;
+			return reinterpret_cast<TYPE*>(arena->data + arena->size - arena->used);
+		}
 	}
+	return 0;
 }
 
 //
@@ -528,10 +555,18 @@ procedure vf2 rotate(const vf2& v, const f32& angle)
 	return { v.x * p.x - v.y * p.y, v.x * p.y + v.y * p.x };
 }
 
-procedure f32 dampen(const f32& a, const f32& b, const f32& k, const f32& dt) { return b + (a - b) * powf(k, dt); }
-procedure vf2 dampen(const vf2& a, const vf2& b, const f32& k, const f32& dt) { return b + (a - b) * powf(k, dt); }
-procedure vf3 dampen(const vf3& a, const vf3& b, const f32& k, const f32& dt) { return b + (a - b) * powf(k, dt); }
-procedure vf4 dampen(const vf4& a, const vf4& b, const f32& k, const f32& dt) { return b + (a - b) * powf(k, dt); }
+// @NOTE@ What's left of the way to `b` after `dt`; everything damped by the same `k` over the same `dt` can share the one `powf`.
+procedure f32 dampen_factor(const f32& k, const f32& dt) { return powf(k, dt); }
+
+procedure constexpr f32 dampen(const f32& a, const f32& b, const f32& factor) { return b + (a - b) * factor; }
+procedure constexpr vf2 dampen(const vf2& a, const vf2& b, const f32& factor) { return b + (a - b) * factor; }
+procedure constexpr vf3 dampen(const vf3& a, const vf3& b, const f32& factor) { return b + (a - b) * factor; }
+procedure constexpr vf4 dampen(const vf4& a, const vf4& b, const f32& factor) { return b + (a - b) * factor; }
+
+procedure f32 dampen(const f32& a, const f32& b, const f32& k, const f32& dt) { return dampen(a, b, dampen_factor(k, dt)); }
+procedure vf2 dampen(const vf2& a, const vf2& b, const f32& k, const f32& dt) { return dampen(a, b, dampen_factor(k, dt)); }
+procedure vf3 dampen(const vf3& a, const vf3& b, const f32& k, const f32& dt) { return dampen(a, b, dampen_factor(k, dt)); }
+procedure vf4 dampen(const vf4& a, const vf4& b, const f32& k, const f32& dt) { return dampen(a, b, dampen_factor(k, dt)); }
 
 procedure constexpr f32 dot(const vf2& u, const vf2& v) { return u.x * v.x + u.y * v.y;                         }
 procedure constexpr f32 dot(const vf3& u, const vf3& v) { return u.x * v.x + u.y * v.y + u.z * v.z;             }
@@ -557,6 +592,13 @@ procedure           f32 mod(const f32& x, const f32& m) { f32 y = fmodf(x, m); r
 
 procedure f32 atan2(const vf2& v) { return atan2f(v.y, v.x); }
 
+procedure constexpr u32 count_leading_zeros(const u32& x) { return x ? static_cast<u32>(__builtin_clz  (x)) : 32; }
+procedure constexpr u32 count_leading_zeros(const u64& x) { return x ? static_cast<u32>(__builtin_clzll(x)) : 64; }
+procedure constexpr u32 count_trailing_zeros(const u32& x) { return x ? static_cast<u32>(__builtin_ctz  (x)) : 32; }
+procedure constexpr u32 count_trailing_zeros(const u64& x) { return x ? static_cast<u32>(__builtin_ctzll(x)) : 64; }
+procedure constexpr u32 count_set_bits      (const u32& x) { return static_cast<u32>(__builtin_popcount  (x)); }
+procedure constexpr u32 count_set_bits      (const u64& x) { return static_cast<u32>(__builtin_popcountll(x)); }
+
 procedure constexpr vf2 complex_mul(const vf2& a, const vf2& b)
 {
 	return { a.x * b.x - a.y * b.y, a.x * b.y + a.y * b.x };